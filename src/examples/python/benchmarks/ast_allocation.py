@@ -0,0 +1,85 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+##
+## Benchmark of the AST nodes allocation.
+##
+## A small loop is emulated with symbolized registers until the number of
+## instructions asked is reached. Every instruction builds new AST nodes, so
+## the time spent into processing() and the peak memory are dominated by the
+## allocation and the recording of the nodes. The time spent to free all the
+## nodes (resetEngines()) is measured too. Run it against two builds of
+## Triton to compare them.
+##
+## Every instruction builds about 125 nodes and they all stay alive, so the
+## default of 50000 instructions already needs 1 to 2GB.
+##
+## Output:
+##
+##  $ ./ast_allocation.py [instructions]
+##  Instructions executed : 50000
+##  Processing time       : 3.88s
+##  Release time          : 1.69s
+##  Peak memory           : 2160.19MB
+##
+
+import  resource
+import  sys
+import  time
+
+from triton import *
+
+
+# The emulated loop.
+#
+#   loop:
+#     add  rax, rbx
+#     xor  rbx, rax
+#     dec  rcx
+#     jnz  loop
+#
+function = {
+  0x1000: "\x48\x01\xd8",   #   add     rax, rbx
+  0x1003: "\x48\x31\xc3",   #   xor     rbx, rax
+  0x1006: "\x48\xff\xc9",   #   dec     rcx
+  0x1009: "\x75\xf5",       #   jnz     0x1000
+}
+
+
+def run(count):
+    setConcreteRegisterValue(Register(REG.RCX, count / len(function)))
+    convertRegisterToSymbolicVariable(REG.RAX)
+    convertRegisterToSymbolicVariable(REG.RBX)
+
+    pc = 0x1000
+    executed = 0
+    while executed < count and pc in function:
+        instruction = Instruction()
+        instruction.setOpcodes(function[pc])
+        instruction.setAddress(pc)
+        processing(instruction)
+        pc = getConcreteRegisterValue(REG.RIP)
+        executed += 1
+
+    return executed
+
+
+if __name__ == '__main__':
+
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 50000
+
+    setArchitecture(ARCH.X86_64)
+
+    start = time.time()
+    executed = run(count)
+    processingTime = time.time() - start
+
+    start = time.time()
+    resetEngines()
+    releaseTime = time.time() - start
+
+    print 'Instructions executed : %d' %(executed)
+    print 'Processing time       : %.2fs' %(processingTime)
+    print 'Release time          : %.2fs' %(releaseTime)
+    print 'Peak memory           : %.2fMB' %(resource.getrusage(resource.RUSAGE_SELF).ru_maxrss / 1024.0)
+
+    sys.exit(0)
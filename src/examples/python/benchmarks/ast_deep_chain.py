@@ -0,0 +1,70 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+##
+## Benchmark of the passes over deep ASTs.
+##
+## A chain of symbolic expressions is built, each one adding one to the
+## previous one through a reference, as a long trace does with a counter.
+## The passes which go through the whole chain are then measured: the
+## unrolling of the references, the slicing, the evaluation, the equality
+## with the same chain built without reference and the translation to Z3.
+## With the default depth of 10^6, a recursive pass overflows the call
+## stack. Run it against two builds of Triton to compare them.
+##
+## Output:
+##
+##  $ ./ast_deep_chain.py [depth]
+##  Chain depth           : <depth>
+##  Building              : <seconds>s
+##  Full AST              : <seconds>s
+##  Slicing               : <seconds>s
+##  Evaluation            : <seconds>s
+##  Equality              : <seconds>s
+##  Z3 translation        : <seconds>s
+##
+
+import  sys
+import  time
+
+from triton     import *
+from triton.ast import *
+
+
+def measure(function, *args):
+    start = time.time()
+    result = function(*args)
+    return result, time.time() - start
+
+
+if __name__ == '__main__':
+
+    depth = int(sys.argv[1]) if len(sys.argv) > 1 else 1000000
+
+    setArchitecture(ARCH.X86_64)
+
+    start = time.time()
+    expr = newSymbolicExpression(bv(0, 64))
+    node = bv(0, 64)
+    for i in range(depth):
+        expr = newSymbolicExpression(bvadd(reference(expr.getId()), bv(1, 64)))
+        node = bvadd(node, bv(1, 64))
+    buildingTime = time.time() - start
+
+    full, fullAstTime = measure(getFullAst, expr.getAst())
+    exprs, slicingTime = measure(sliceExpressions, expr)
+    value, evaluationTime = measure(full.evaluate)
+    equal, equalityTime = measure(full.equalTo, node)
+    z3Value, z3Time = measure(evaluateAstViaZ3, full)
+
+    assert len(exprs) == depth + 1
+    assert value == depth and z3Value == depth and equal
+
+    print 'Chain depth           : %d' %(depth)
+    print 'Building              : %.2fs' %(buildingTime)
+    print 'Full AST              : %.2fs' %(fullAstTime)
+    print 'Slicing               : %.2fs' %(slicingTime)
+    print 'Evaluation            : %.2fs' %(evaluationTime)
+    print 'Equality              : %.2fs' %(equalityTime)
+    print 'Z3 translation        : %.2fs' %(z3Time)
+
+    sys.exit(0)
@@ -0,0 +1,86 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+##
+## Benchmark of the AST equality.
+##
+## The rules of simplification.py compare whole subtrees with equalTo().
+## Two chains of nodes are built independently with the same shape, and the
+## rules are applied on them many times: once on two equal trees (the worst
+## case, the whole trees are walked) and once on two trees which differ only
+## at their leaves. Run it against two builds of Triton to compare them.
+##
+## Output:
+##
+##  $ ./ast_equality.py [depth] [rounds]
+##  Tree depth            : 1000
+##  Equal trees           : 1.45s
+##  Different trees       : 0.00s
+##  Simplifications       : 1.60s
+##
+
+import  sys
+import  time
+
+from triton     import *
+from triton.ast import *
+
+
+# a ^ a -> a = 0
+def xor_1(node):
+    if node.getKind() == AST_NODE.BVXOR:
+        if node.getChilds()[0].equalTo(node.getChilds()[1]):
+            return bv(0, node.getBitvectorSize())
+    return node
+
+
+# Builds ((((leaf + 1) ^ 2) + 3) ^ 4) ...
+def chain(leaf, depth):
+    node = leaf
+    for i in range(depth):
+        if i % 2:
+            node = bvxor(node, bv(i, 64))
+        else:
+            node = bvadd(node, bv(i, 64))
+    return node
+
+
+def measure(rounds, a, b):
+    start = time.time()
+    for i in range(rounds):
+        a.equalTo(b)
+    return time.time() - start
+
+
+if __name__ == '__main__':
+
+    depth  = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+    rounds = int(sys.argv[2]) if len(sys.argv) > 2 else 10000
+
+    setArchitecture(ARCH.X86_64)
+
+    # The dictionaries would give the same nodes to the equal trees
+    enableMode(MODE.AST_DICTIONARIES, False)
+
+    addCallback(xor_1, CALLBACK.SYMBOLIC_SIMPLIFICATION)
+
+    x = variable(newSymbolicVariable(64))
+    y = variable(newSymbolicVariable(64))
+
+    a = chain(x, depth)
+    b = chain(x, depth)
+    c = chain(y, depth)
+
+    equalTime = measure(rounds, a, b)
+    differentTime = measure(rounds, a, c)
+
+    start = time.time()
+    for i in range(rounds):
+        simplify(bvxor(a, b))
+    simplificationTime = time.time() - start
+
+    print 'Tree depth            : %d' %(depth)
+    print 'Equal trees           : %.2fs' %(equalTime)
+    print 'Different trees       : %.2fs' %(differentTime)
+    print 'Simplifications       : %.2fs' %(simplificationTime)
+
+    sys.exit(0)
@@ -0,0 +1,55 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+##
+## Benchmark of the SMT representations.
+##
+## A CRC-like loop is unrolled, each round uses the previous state twice,
+## then its full AST is printed with AST_REPRESENTATION.SMT, which expands
+## the tree, and with AST_REPRESENTATION.SMT_DAG, which prints each shared
+## node once. Run it against two builds of Triton to compare them.
+##
+## Output:
+##
+##  $ ./ast_representation.py [rounds]
+##  Rounds                : <count>
+##  SMT characters        : <count>
+##  SMT                   : <seconds>s
+##  SMT_DAG characters    : <count>
+##  SMT_DAG               : <seconds>s
+##
+
+import  sys
+import  time
+
+from triton     import *
+from triton.ast import *
+
+
+def measure(node, mode):
+    setAstRepresentationMode(mode)
+    start = time.time()
+    text = str(node)
+    return len(text), time.time() - start
+
+
+if __name__ == '__main__':
+
+    rounds = int(sys.argv[1]) if len(sys.argv) > 1 else 16
+
+    setArchitecture(ARCH.X86_64)
+
+    data = variable(newSymbolicVariable(32))
+    node = bv(0xffffffff, 32)
+    for i in range(rounds):
+        node = bvxor(bvlshr(node, bv(1, 32)), bvand(bv(0xedb88320, 32), bvneg(bvand(bvxor(node, data), bv(1, 32)))))
+
+    smtLength, smtTime = measure(node, AST_REPRESENTATION.SMT)
+    dagLength, dagTime = measure(node, AST_REPRESENTATION.SMT_DAG)
+
+    print 'Rounds                : %d' %(rounds)
+    print 'SMT characters        : %d' %(smtLength)
+    print 'SMT                   : %.2fs' %(smtTime)
+    print 'SMT_DAG characters    : %d' %(dagLength)
+    print 'SMT_DAG               : %.2fs' %(dagTime)
+
+    sys.exit(0)
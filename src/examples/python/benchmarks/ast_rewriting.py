@@ -0,0 +1,94 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+##
+## Benchmark of the rewriting rules.
+##
+## Expressions obfuscated with the mixed boolean-arithmetic identity
+## (x | y) - (x & y) = x ^ y are simplified twice: once with a Python
+## simplification callback which walks and rebuilds the tree itself, and
+## once with the same identity recorded by addSimplificationRule(). Both
+## must give the same trees. Run it against two builds of Triton to
+## compare them.
+##
+## Output:
+##
+##  $ ./ast_rewriting.py [expressions]
+##  Expressions           : <count>
+##  Python callback       : <seconds>s
+##  Rewriting rule        : <seconds>s
+##
+
+import  sys
+import  time
+
+from triton     import *
+from triton.ast import *
+
+
+DEPTH = 50
+
+BUILDERS = {
+    AST_NODE.BVAND: lambda a, b: a & b,
+    AST_NODE.BVOR:  lambda a, b: a | b,
+    AST_NODE.BVSUB: lambda a, b: a - b,
+    AST_NODE.BVXOR: lambda a, b: a ^ b,
+}
+
+
+# (x | y) - (x & y) -> x ^ y, applied bottom-up. The shared sub-trees are
+# rewritten once.
+def mba(node, rewritten=None):
+    if rewritten is None:
+        rewritten = dict()
+
+    if node.getKind() not in BUILDERS:
+        return node
+    if node.getHash() in rewritten:
+        return rewritten[node.getHash()]
+
+    a, b = [mba(child, rewritten) for child in node.getChilds()]
+    result = BUILDERS[node.getKind()](a, b)
+    if node.getKind() == AST_NODE.BVSUB and a.getKind() == AST_NODE.BVOR and b.getKind() == AST_NODE.BVAND:
+        x, y = a.getChilds()
+        if (b.getChilds()[0].equalTo(x) and b.getChilds()[1].equalTo(y)) or (b.getChilds()[0].equalTo(y) and b.getChilds()[1].equalTo(x)):
+            result = x ^ y
+
+    rewritten[node.getHash()] = result
+    return result
+
+
+def measure(nodes):
+    start = time.time()
+    results = [simplify(node) for node in nodes]
+    return results, time.time() - start
+
+
+if __name__ == '__main__':
+
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+
+    setArchitecture(ARCH.X86_64)
+
+    symvars = [variable(newSymbolicVariable(32)) for i in range(DEPTH + 1)]
+    nodes = []
+    for i in range(count):
+        node = symvars[0]
+        for y in symvars[1:]:
+            node = (node | y) - (node & y)
+        nodes.append(node)
+
+    addCallback(mba, CALLBACK.SYMBOLIC_SIMPLIFICATION)
+    callbackResults, callbackTime = measure(nodes)
+    removeAllCallbacks()
+
+    addSimplificationRule('(bvsub (bvor x y) (bvand x y)) -> (bvxor x y)')
+    ruleResults, ruleTime = measure(nodes)
+
+    for a, b in zip(callbackResults, ruleResults):
+        assert a.equalTo(b)
+
+    print 'Expressions           : %d' %(count)
+    print 'Python callback       : %.2fs' %(callbackTime)
+    print 'Rewriting rule        : %.2fs' %(ruleTime)
+
+    sys.exit(0)
@@ -0,0 +1,83 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+##
+## Benchmark of the compiled AST evaluator.
+##
+## The opaque predicate of proving_opaque_predicates.py (the overflow flag
+## of an addition of two masked registers) is tested with random inputs,
+## as a random testing would do before asking the solver. Each input is
+## evaluated once with Z3 (evaluateAstViaZ3) and once with the tape built
+## by compileAst(), then all the inputs are given at once to evaluateBatch().
+## All must give the same results. Run it against two builds of Triton to
+## compare them.
+##
+## Output:
+##
+##  $ ./ast_tape.py [inputs]
+##  Inputs                : <count>
+##  Instructions          : <count>
+##  Z3 evaluations        : <evaluations>/s
+##  Tape evaluations      : <evaluations>/s
+##  Batch evaluations     : <evaluations>/s
+##
+
+import  random
+import  sys
+import  time
+
+from triton import *
+
+
+trace = [
+    "\x25\xff\xff\xff\x3f",      # and eax, 0x3fffffff
+    "\x81\xe3\xff\xff\xff\x3f",  # and ebx, 0x3fffffff
+    "\x31\xd1",                  # xor ecx, edx
+    "\x31\xfa",                  # xor edx, edi
+    "\x01\xd8",                  # add eax, ebx
+]
+
+
+if __name__ == '__main__':
+
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 10000
+
+    setArchitecture(ARCH.X86_64)
+
+    symvars = [convertRegisterToSymbolicVariable(reg) for reg in [REG.EAX, REG.EBX, REG.ECX, REG.EDX, REG.EDI]]
+    for opcodes in trace:
+        inst = Instruction()
+        inst.setOpcodes(opcodes)
+        processing(inst)
+
+    predicate = getFullAst(getSymbolicExpressionFromId(getSymbolicRegisterId(REG.OF)).getAst())
+    tape = compileAst(predicate)
+    inputs = [dict((symvar.getId(), random.getrandbits(32)) for symvar in symvars) for i in range(count)]
+
+    start = time.time()
+    z3Results = []
+    for values in inputs:
+        for symvar in symvars:
+            symvar.setConcreteValue(values[symvar.getId()])
+        z3Results.append(evaluateAstViaZ3(predicate))
+    z3Time = time.time() - start
+
+    start = time.time()
+    tapeResults = []
+    for values in inputs:
+        tapeResults.append(tape.evaluate(values))
+    tapeTime = time.time() - start
+
+    start = time.time()
+    batchResults = tape.evaluateBatch(inputs)
+    batchTime = time.time() - start
+
+    assert z3Results == tapeResults
+    assert z3Results == batchResults
+
+    print 'Inputs                : %d' %(count)
+    print 'Instructions          : %d' %(tape.getNumberOfInstructions())
+    print 'Z3 evaluations        : %d/s' %(count / z3Time)
+    print 'Tape evaluations      : %d/s' %(count / tapeTime)
+    print 'Batch evaluations     : %d/s' %(count / batchTime)
+
+    sys.exit(0)
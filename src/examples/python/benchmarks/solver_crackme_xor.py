@@ -0,0 +1,159 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+##
+## Benchmark of the solver interface on the crackme_xor sample.
+##
+## The check function of the crackme is emulated with a symbolized serial,
+## then a model is asked for every branch which has not been taken (like a
+## code coverage would do). The time spent into getModel() is measured and
+## displayed. The first round is shown apart from the later ones, which ask
+## the same queries again. Run it against two builds of Triton to compare
+## them.
+##
+## Output:
+##
+##  $ ./solver_crackme_xor.py [rounds]
+##  Instructions executed : 110
+##  Queries per round     : 5
+##  Rounds                : 20
+##  First round           : 0.12s (24.46ms per query)
+##  Other rounds          : 2.11s (22.19ms per query)
+##
+
+import  sys
+import  time
+
+from triton     import *
+from triton.ast import *
+
+
+# The check function of src/samples/crackmes/crackme_xor. The source code
+# is basically:
+#
+#     char *serial = "\x31\x3e\x3d\x26\x31";
+#
+#     int check(char *ptr)
+#     {
+#       int i = 0;
+#
+#       while (i < 5){
+#         if (((ptr[i] - 1) ^ 0x55) != serial[i])
+#           return 1;
+#         i++;
+#       }
+#       return 0;
+#     }
+#
+function = {
+                                              #   <serial> function
+  0x40056d: "\x55",                           #   push    rbp
+  0x40056e: "\x48\x89\xe5",                   #   mov     rbp,rsp
+  0x400571: "\x48\x89\x7d\xe8",               #   mov     QWORD PTR [rbp-0x18],rdi
+  0x400575: "\xc7\x45\xfc\x00\x00\x00\x00",   #   mov     DWORD PTR [rbp-0x4],0x0
+  0x40057c: "\xeb\x3f",                       #   jmp     4005bd <check+0x50>
+  0x40057e: "\x8b\x45\xfc",                   #   mov     eax,DWORD PTR [rbp-0x4]
+  0x400581: "\x48\x63\xd0",                   #   movsxd  rdx,eax
+  0x400584: "\x48\x8b\x45\xe8",               #   mov     rax,QWORD PTR [rbp-0x18]
+  0x400588: "\x48\x01\xd0",                   #   add     rax,rdx
+  0x40058b: "\x0f\xb6\x00",                   #   movzx   eax,BYTE PTR [rax]
+  0x40058e: "\x0f\xbe\xc0",                   #   movsx   eax,al
+  0x400591: "\x83\xe8\x01",                   #   sub     eax,0x1
+  0x400594: "\x83\xf0\x55",                   #   xor     eax,0x55
+  0x400597: "\x89\xc1",                       #   mov     ecx,eax
+  0x400599: "\x48\x8b\x15\xa0\x0a\x20\x00",   #   mov     rdx,QWORD PTR [rip+0x200aa0]        # 601040 <serial>
+  0x4005a0: "\x8b\x45\xfc",                   #   mov     eax,DWORD PTR [rbp-0x4]
+  0x4005a3: "\x48\x98",                       #   cdqe
+  0x4005a5: "\x48\x01\xd0",                   #   add     rax,rdx
+  0x4005a8: "\x0f\xb6\x00",                   #   movzx   eax,BYTE PTR [rax]
+  0x4005ab: "\x0f\xbe\xc0",                   #   movsx   eax,al
+  0x4005ae: "\x39\xc1",                       #   cmp     ecx,eax
+  0x4005b0: "\x74\x07",                       #   je      4005b9 <check+0x4c>
+  0x4005b2: "\xb8\x01\x00\x00\x00",           #   mov     eax,0x1
+  0x4005b7: "\xeb\x0f",                       #   jmp     4005c8 <check+0x5b>
+  0x4005b9: "\x83\x45\xfc\x01",               #   add     DWORD PTR [rbp-0x4],0x1
+  0x4005bd: "\x83\x7d\xfc\x04",               #   cmp     DWORD PTR [rbp-0x4],0x4
+  0x4005c1: "\x7e\xbb",                       #   jle     40057e <check+0x11>
+  0x4005c3: "\xb8\x00\x00\x00\x00",           #   mov     eax,0x0
+  0x4005c8: "\x5d",                           #   pop     rbp
+  0x4005c9: "\xc3",                           #   ret
+}
+
+# The valid serial, so that every iteration of the loop is executed.
+SERIAL = "elite"
+
+
+# This function emulates the code and returns the number of instructions executed.
+def run(ip):
+    count = 0
+    while ip in function:
+        inst = Instruction()
+        inst.setOpcodes(function[ip])
+        inst.setAddress(ip)
+        processing(inst)
+        count += 1
+        ip = buildSymbolicRegister(REG.RIP).evaluate()
+    return count
+
+
+# This function initializes the context memory.
+def initContext():
+    # The serial pointer and the serial content.
+    setConcreteMemoryValue(0x601040, 0x00)
+    setConcreteMemoryValue(0x601041, 0x00)
+    setConcreteMemoryValue(0x601042, 0x90)
+    for index, value in enumerate([0x31, 0x3e, 0x3d, 0x26, 0x31]):
+        setConcreteMemoryValue(0x900000 + index, value)
+
+    # The user input, symbolized byte per byte.
+    for index, char in enumerate(SERIAL):
+        setConcreteMemoryValue(0x1000 + index, ord(char))
+        convertMemoryToSymbolicVariable(MemoryAccess(0x1000 + index, CPUSIZE.BYTE))
+
+    # Point RDI on the user input and setup the stack.
+    setConcreteRegisterValue(Register(REG.RDI, 0x1000))
+    setConcreteRegisterValue(Register(REG.RSP, 0x7fffffff))
+    setConcreteRegisterValue(Register(REG.RBP, 0x7fffffff))
+    return
+
+
+# This function returns the constraints of all branches which have not been taken.
+def getQueries():
+    queries  = list()
+    previous = equal(bvtrue(), bvtrue())
+
+    for pc in getPathConstraints():
+        if pc.isMultipleBranches():
+            for branch in pc.getBranchConstraints():
+                if branch['isTaken'] == False:
+                    queries.append(assert_(land(previous, branch['constraint'])))
+        previous = land(previous, pc.getTakenPathConstraintAst())
+
+    return queries
+
+
+if __name__ == '__main__':
+
+    rounds = int(sys.argv[1]) if len(sys.argv) > 1 else 20
+
+    setArchitecture(ARCH.X86_64)
+    initContext()
+    count   = run(0x40056d)
+    queries = getQueries()
+
+    times = list()
+    for _ in range(rounds):
+        start = time.time()
+        for query in queries:
+            getModel(query)
+        times.append(time.time() - start)
+
+    first  = times[0] if times else 0.0
+    others = sum(times[1:])
+
+    print 'Instructions executed : %d' %(count)
+    print 'Queries per round     : %d' %(len(queries))
+    print 'Rounds                : %d' %(rounds)
+    print 'First round           : %.2fs (%.2fms per query)' %(first, first * 1000 / max(1, len(queries)))
+    print 'Other rounds          : %.2fs (%.2fms per query)' %(others, others * 1000 / max(1, (rounds - 1) * len(queries)))
+
+    sys.exit(0)
@@ -378,6 +378,10 @@ namespace triton {
     if (this->solver == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
+    this->solverSession = new(std::nothrow) triton::engines::solver::SolverSession(this->modes, this->symbolic);
+    if (this->solverSession == nullptr)
+      throw triton::exceptions::API("API::initEngines(): No enough memory.");
+
     this->astGarbageCollector = new(std::nothrow) triton::ast::AstGarbageCollector(this->modes);
     if (this->astGarbageCollector == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
@@ -402,6 +406,7 @@ namespace triton {
       delete this->irBuilder;
       delete this->modes;
       delete this->solver;
+      delete this->solverSession;
       delete this->symbolic;
       delete this->taint;
       delete this->z3Interface;
@@ -410,6 +415,7 @@ namespace triton {
       this->irBuilder           = nullptr;
       this->modes               = nullptr;
       this->solver              = nullptr;
+      this->solverSession       = nullptr;
       this->symbolic            = nullptr;
       this->taint               = nullptr;
       this->z3Interface         = nullptr;
@@ -459,13 +465,22 @@ namespace triton {
 
   void API::freeAllAstNodes(void) {
     this->checkAstGarbageCollector();
+    /* The full ASTs kept by the symbolic engine are freed too */
+    if (this->symbolic)
+      this->symbolic->invalidateFullAsts();
     this->astGarbageCollector->freeAllAstNodes();
+    /* The solver session caches translations by node identity */
+    if (this->solverSession)
+      this->solverSession->reset();
   }
 
 
   void API::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
     this->checkAstGarbageCollector();
     this->astGarbageCollector->freeAstNodes(nodes);
+    /* The solver session caches translations by node identity */
+    if (this->solverSession)
+      this->solverSession->reset();
   }
 
 
@@ -487,7 +502,7 @@ namespace triton {
   }
 
 
-  const std::set<triton::ast::AbstractNode*>& API::getAllocatedAstNodes(void) const {
+  const std::vector<triton::ast::AbstractNode*>& API::getAllocatedAstNodes(void) const {
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAllocatedAstNodes();
   }
@@ -499,6 +514,12 @@ namespace triton {
   }
 
 
+  std::map<std::string, triton::usize> API::getAstMemoryStats(void) const {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getAstMemoryStats();
+  }
+
+
   const std::map<std::string, triton::ast::AbstractNode*>& API::getAstVariableNodes(void) const {
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAstVariableNodes();
@@ -511,7 +532,7 @@ namespace triton {
   }
 
 
-  void API::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
+  void API::setAllocatedAstNodes(const std::vector<triton::ast::AbstractNode*>& nodes) {
     this->checkAstGarbageCollector();
     this->astGarbageCollector->setAllocatedAstNodes(nodes);
   }
@@ -553,6 +574,11 @@ namespace triton {
   }
 
 
+  void API::addCallback(triton::callbacks::symbolicSimplificationCallback cb, const std::set<triton::ast::kind_e>& kinds, triton::uint32 minSize) {
+    this->callbacks.addCallback(cb, kinds, minSize);
+  }
+
+
   void API::removeAllCallbacks(void) {
     this->callbacks.removeAllCallbacks();
   }
@@ -811,6 +837,30 @@ namespace triton {
   }
 
 
+  void API::addSimplificationRule(const std::string& rule) {
+    this->checkSymbolic();
+    this->symbolic->addSimplificationRule(rule);
+  }
+
+
+  void API::addDefaultSimplificationRules(void) {
+    this->checkSymbolic();
+    this->symbolic->addDefaultSimplificationRules();
+  }
+
+
+  void API::clearSimplificationRules(void) {
+    this->checkSymbolic();
+    this->symbolic->clearSimplificationRules();
+  }
+
+
+  std::vector<std::string> API::getSimplificationRules(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getSimplificationRules();
+  }
+
+
   triton::engines::symbolic::SymbolicExpression* API::getSymbolicExpressionFromId(triton::usize symExprId) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpressionFromId(symExprId);
@@ -850,6 +900,8 @@ namespace triton {
   void API::clearPathConstraints(void) {
     this->checkSymbolic();
     this->symbolic->clearPathConstraints();
+    if (this->solverSession)
+      this->solverSession->reset();
   }
 
 
@@ -939,6 +991,12 @@ namespace triton {
   }
 
 
+  triton::ast::AstTape API::compileAst(triton::ast::AbstractNode* node) const {
+    this->checkSymbolic();
+    return triton::ast::AstTape(node, this->symbolic);
+  }
+
+
   std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> API::sliceExpressions(triton::engines::symbolic::SymbolicExpression* expr) {
     this->checkSymbolic();
     return this->symbolic->sliceExpressions(expr);
@@ -951,13 +1009,13 @@ namespace triton {
   }
 
 
-  const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& API::getSymbolicExpressions(void) const {
+  const triton::engines::symbolic::SymbolicStorage<triton::engines::symbolic::SymbolicExpression>& API::getSymbolicExpressions(void) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpressions();
   }
 
 
-  const std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>& API::getSymbolicVariables(void) const {
+  const triton::engines::symbolic::SymbolicStorage<triton::engines::symbolic::SymbolicVariable>& API::getSymbolicVariables(void) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariables();
   }
@@ -967,7 +1025,7 @@ namespace triton {
   /* Solver engine API ============================================================================= */
 
   void API::checkSolver(void) const {
-    if (!this->solver)
+    if (!this->solver || !this->solverSession)
       throw triton::exceptions::API("API::checkSolver(): Solver engine is undefined.");
   }
 
@@ -978,12 +1036,96 @@ namespace triton {
   }
 
 
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(triton::ast::AbstractNode* node, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit) const {
+    this->checkSolver();
+    return this->solver->getModel(node, timeout, memoryLimit, conflictLimit);
+  }
+
+
   std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const {
     this->checkSolver();
     return this->solver->getModels(node, limit);
   }
 
 
+  std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit) const {
+    this->checkSolver();
+    return this->solver->getModels(node, limit, timeout, memoryLimit, conflictLimit);
+  }
+
+
+  const std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>>& API::getModelsForUntakenBranches(void) {
+    this->checkSolver();
+    return this->solverSession->getModelsForUntakenBranches();
+  }
+
+
+  std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModelsForAllBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 maxThreads) const {
+    this->checkSolver();
+    return this->solver->getModelsForAllBranches(pathConstraints, maxThreads);
+  }
+
+
+  void API::translateBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 maxThreads, triton::engines::solver::SolverBranches& branches) const {
+    this->checkSolver();
+    this->solver->translateBranches(pathConstraints, maxThreads, branches);
+  }
+
+
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModelUnderPathConstraints(triton::ast::AbstractNode* node) {
+    this->checkSolver();
+    return this->solverSession->getModel(node);
+  }
+
+
+  void API::resetSolverSession(void) {
+    this->checkSolver();
+    this->solverSession->reset();
+  }
+
+
+  std::map<std::string, triton::usize> API::getSolverCacheStats(void) const {
+    this->checkSolver();
+    return this->solver->getCacheStats();
+  }
+
+
+  void API::clearSolverCache(void) {
+    this->checkSolver();
+    this->solver->clearCache();
+  }
+
+
+  void API::setSolverCacheLimit(triton::usize maxBytes) {
+    this->checkSolver();
+    this->solver->setCacheLimit(maxBytes);
+  }
+
+
+  void API::setSolverTimeout(triton::uint32 timeout) {
+    this->checkSolver();
+    this->solver->setTimeout(timeout);
+  }
+
+
+  void API::setSolverMemoryLimit(triton::uint32 memoryLimit) {
+    this->checkSolver();
+    this->solver->setMemoryLimit(memoryLimit);
+  }
+
+
+  void API::setSolverConflictLimit(triton::uint32 conflictLimit) {
+    this->checkSolver();
+    this->solver->setConflictLimit(conflictLimit);
+  }
+
+
+  const std::map<std::string, triton::usize>& API::getSolverQueryStats(void) const {
+    this->checkSolver();
+    return this->solver->getQueryStats();
+  }
+
+
 
   /* Z3 interface API ============================================================================== */
 
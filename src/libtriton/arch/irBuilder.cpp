@@ -117,7 +117,7 @@ namespace triton {
 
 
     void IrBuilder::postIrInit(triton::arch::Instruction& inst) {
-      std::set<triton::ast::AbstractNode*> uniqueNodes;
+      std::vector<triton::ast::AbstractNode*> unusedNodes;
       std::vector<triton::engines::symbolic::SymbolicExpression*> newVector;
 
       /* Clear unused data */
@@ -133,7 +133,7 @@ namespace triton {
        * is enable we must compute semanitcs to spread the taint.
        */
       if (!this->symbolicEngine->isEnabled()) {
-        this->removeSymbolicExpressions(inst, uniqueNodes);
+        this->removeSymbolicExpressions(inst, unusedNodes);
         *this->symbolicEngine = *this->backupSymbolicEngine;
       }
 
@@ -143,7 +143,7 @@ namespace triton {
        * expressions untainted and their AST nodes.
        */
       if (this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) && !inst.isTainted()) {
-        this->removeSymbolicExpressions(inst, uniqueNodes);
+        this->removeSymbolicExpressions(inst, unusedNodes);
       }
 
       /*
@@ -154,7 +154,7 @@ namespace triton {
       if (this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED)) {
         for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
           if ((*it)->getAst()->isSymbolized() == false) {
-            this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+            unusedNodes.push_back((*it)->getAst());
             this->symbolicEngine->removeSymbolicExpression((*it)->getId());
           }
           else
@@ -165,13 +165,14 @@ namespace triton {
 
       /*
        * If there is no symbolic expression, clean memory operands AST
-       * and implicit/explicit semantics AST to avoid memory leak.
+       * and implicit/explicit semantics AST to avoid memory leak. They
+       * are only freed if no other node references them.
        */
       if (inst.symbolicExpressions.size() == 0) {
         /* Memory operands */
         for (auto it = inst.operands.begin(); it!= inst.operands.end(); it++) {
           if (it->getType() == triton::arch::OP_MEM) {
-            this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, it->getMemory().getLeaAst());
+            unusedNodes.push_back(it->getMemory().getLeaAst());
           }
         }
 
@@ -181,28 +182,32 @@ namespace triton {
         const auto& readImmediates = inst.getReadImmediates();
 
         for (auto it = loadAccess.begin(); it != loadAccess.end(); it++)
-          this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, std::get<1>(*it));
+          unusedNodes.push_back(std::get<1>(*it));
 
         /* Implicit and explicit semantics - REG */
         for (auto it = readRegisters.begin(); it != readRegisters.end(); it++)
-          this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, std::get<1>(*it));
+          unusedNodes.push_back(std::get<1>(*it));
 
         /* Implicit and explicit semantics - IMM */
         for (auto it = readImmediates.begin(); it != readImmediates.end(); it++)
-          this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, std::get<1>(*it));
+          unusedNodes.push_back(std::get<1>(*it));
       }
 
-      /* Free collected nodes */
-      this->astGarbageCollector->freeAstNodes(uniqueNodes);
-
-      if (!this->symbolicEngine->isEnabled())
+      /*
+       * Free the collected nodes which are not referenced anymore. If the
+       * symbolic engine is disabled, restoring the garbage collector frees
+       * every node built by this instruction at once.
+       */
+      if (this->symbolicEngine->isEnabled())
+        this->astGarbageCollector->freeUnreferencedAstNodes(unusedNodes);
+      else
         *this->astGarbageCollector = *this->backupAstGarbageCollector;
     }
 
 
-    void IrBuilder::removeSymbolicExpressions(triton::arch::Instruction& inst, std::set<triton::ast::AbstractNode*>& uniqueNodes) {
+    void IrBuilder::removeSymbolicExpressions(triton::arch::Instruction& inst, std::vector<triton::ast::AbstractNode*>& unusedNodes) {
       for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
-        this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+        unusedNodes.push_back((*it)->getAst());
         this->symbolicEngine->removeSymbolicExpression((*it)->getId());
       }
       inst.symbolicExpressions.clear();
@@ -5,12 +5,17 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cmath>
 #include <new>
+#include <unordered_set>
+#include <vector>
 
 #include <triton/api.hpp>
 #include <triton/ast.hpp>
+#include <triton/astAllocator.hpp>
 #include <triton/astRepresentation.hpp>
+#include <triton/astWalker.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/tritonToZ3Ast.hpp>
 #include <triton/z3Result.hpp>
@@ -20,43 +25,151 @@
 namespace triton {
   namespace ast {
 
+    /* ====== Hash utils */
+
+    /* Mixes a value into a hash (64-bit version of boost::hash_combine) */
+    static inline triton::uint64 hashCombine(triton::uint64 seed, triton::uint64 value) {
+      return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+
+
+    /* Scrambles a hash (MurmurHash3 finalizer) */
+    static inline triton::uint64 hashMix(triton::uint64 h) {
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33;
+      h *= 0xc4ceb9fe1a85ec53ULL;
+      h ^= h >> 33;
+      return h;
+    }
+
+
+    /* Hashes a string (FNV-1a) */
+    static inline triton::uint64 hashString(const std::string& str) {
+      triton::uint64 h = 0xcbf29ce484222325ULL;
+      for (char c : str) {
+        h ^= static_cast<triton::uint8>(c);
+        h *= 0x100000001b3ULL;
+      }
+      return h;
+    }
+
+
+    /* Returns true if the order of the childs does not matter */
+    static bool isCommutative(enum kind_e kind) {
+      switch (kind) {
+        case ASSERT_NODE:
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNEG_NODE:
+        case BVNOR_NODE:
+        case BVNOT_NODE:
+        case BVOR_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case COMPOUND_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case LAND_NODE:
+        case LNOT_NODE:
+        case LOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
     /* ====== Abstract node */
 
+    triton::usize AbstractNode::generation = 0;
+    triton::usize AbstractNode::freedNodes = 0;
+
+
     AbstractNode::AbstractNode(enum kind_e kind) {
-      this->eval        = 0;
+      this->dirty       = false;
       this->kind        = kind;
+      this->hash        = 0;
+      this->nativeEval  = 0;
+      this->recordIndex = 0;
+      this->references  = 0;
       this->size        = 0;
       this->symbolized  = false;
+      this->wideEval    = nullptr;
     }
 
 
     AbstractNode::AbstractNode() {
-      this->eval        = 0;
+      this->dirty       = false;
       this->kind        = UNDEFINED_NODE;
+      this->hash        = 0;
+      this->nativeEval  = 0;
+      this->recordIndex = 0;
+      this->references  = 0;
       this->size        = 0;
       this->symbolized  = false;
+      this->wideEval    = nullptr;
     }
 
 
     AbstractNode::AbstractNode(const AbstractNode& copy) {
-      this->eval        = copy.eval;
+      this->dirty       = copy.dirty;
+      this->hash        = copy.hash;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
+      this->nativeEval  = copy.nativeEval;
+      this->recordIndex = 0;
+      this->references  = 0;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
+      this->wideEval    = nullptr;
+
+      if (copy.wideEval != nullptr)
+        this->setWideEval(*copy.wideEval);
 
+      /* The copy shares the childs of the original node (See: triton::ast::newInstance() for a deep copy) */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
-        this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+        this->addChild(copy.childs[index]);
     }
 
 
     AbstractNode::~AbstractNode() {
-      /* virtual */
+      if (this->wideEval != nullptr) {
+        this->wideEval->~uint512();
+        triton::ast::AstAllocator::getInstance().deallocateOutOfLine(this->wideEval, sizeof(triton::uint512));
+      }
+
+      /* The address of the node may now be given again */
+      AbstractNode::freedNodes++;
+    }
+
+
+    void* AbstractNode::operator new(std::size_t size) {
+      void* ptr = triton::ast::AstAllocator::getInstance().allocate(size);
+      if (ptr == nullptr)
+        throw std::bad_alloc();
+      return ptr;
+    }
+
+
+    void* AbstractNode::operator new(std::size_t size, const std::nothrow_t&) throw() {
+      return triton::ast::AstAllocator::getInstance().allocate(size);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr, std::size_t size) {
+      triton::ast::AstAllocator::getInstance().deallocate(ptr, size);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr, const std::nothrow_t&) throw() {
+      triton::ast::AstAllocator::getInstance().deallocate(ptr);
     }
 
 
     enum kind_e AbstractNode::getKind(void) const {
-      return this->kind;
+      return static_cast<enum kind_e>(this->kind);
     }
 
 
@@ -72,8 +185,19 @@ namespace triton {
     }
 
 
+    triton::uint64 AbstractNode::getNativeMask(void) const {
+      if (this->size >= 64)
+        return 0xffffffffffffffffULL;
+      return ((1ULL << this->size) - 1);
+    }
+
+
     bool AbstractNode::isSigned(void) const {
-      if ((this->eval >> (this->size-1)) & 1)
+      if (this->size == 0)
+        return false;
+      if (this->size <= 64)
+        return ((this->evaluateNative() >> (this->size-1)) & 1);
+      if ((this->evaluate() >> (this->size-1)) & 1)
         return true;
       return false;
     }
@@ -85,9 +209,61 @@ namespace triton {
 
 
     bool AbstractNode::equalTo(const AbstractNode& other) const {
-      return (this->evaluate() == other.evaluate()) &&
-             (this->getBitvectorSize() == other.getBitvectorSize()) &&
-             (this->hash(1) == other.hash(1));
+      /* The pairs of nodes are compared with an explicit stack, so that deep trees do not overflow the call stack */
+      std::vector<std::pair<const AbstractNode*, const AbstractNode*>> pending;
+      pending.push_back(std::make_pair(this, &other));
+
+      while (!pending.empty()) {
+        const AbstractNode* a = pending.back().first;
+        const AbstractNode* b = pending.back().second;
+        pending.pop_back();
+
+        if (a == b)
+          continue;
+
+        if (a->hash != b->hash ||
+            a->kind != b->kind ||
+            a->size != b->size ||
+            a->childs.size() != b->childs.size())
+          return false;
+
+        /* Same hash, confirm it by walking the trees */
+        bool equal = true;
+        switch (a->kind) {
+          case DECIMAL_NODE:
+            equal = static_cast<const DecimalNode*>(a)->getValue() == static_cast<const DecimalNode*>(b)->getValue();
+            break;
+          case REFERENCE_NODE:
+            equal = static_cast<const ReferenceNode*>(a)->getValue() == static_cast<const ReferenceNode*>(b)->getValue();
+            break;
+          case STRING_NODE:
+            equal = static_cast<const StringNode*>(a)->getValue() == static_cast<const StringNode*>(b)->getValue();
+            break;
+          case VARIABLE_NODE:
+            equal = static_cast<const VariableNode*>(a)->getValue() == static_cast<const VariableNode*>(b)->getValue();
+            break;
+          default:
+            break;
+        }
+        if (!equal)
+          return false;
+
+        /*
+         * (op a b) is equal to (op b a) if op is commutative. The hashes of the childs tell which
+         * pairing to confirm: when both pairings match, the four childs share the same hash.
+         */
+        if (a->childs.size() == 2 && isCommutative(a->getKind()) &&
+            (a->childs[0]->hash != b->childs[0]->hash || a->childs[1]->hash != b->childs[1]->hash)) {
+          pending.push_back(std::make_pair(a->childs[0], b->childs[1]));
+          pending.push_back(std::make_pair(a->childs[1], b->childs[0]));
+          continue;
+        }
+
+        for (triton::uint32 index = 0; index < a->childs.size(); index++)
+          pending.push_back(std::make_pair(a->childs[index], b->childs[index]));
+      }
+
+      return true;
     }
 
 
@@ -96,42 +272,242 @@ namespace triton {
     }
 
 
+    triton::uint64 AbstractNode::getHash(void) const {
+      return this->hash;
+    }
+
+
+    void AbstractNode::initHash(void) {
+      triton::uint64 h = hashCombine(this->kind, this->size);
+
+      switch (this->kind) {
+        case DECIMAL_NODE: {
+          triton::uint512 value = static_cast<DecimalNode*>(this)->getValue();
+          while (value != 0) {
+            h = hashCombine(h, triton::uint512(value & 0xffffffffffffffffULL).convert_to<triton::uint64>());
+            value >>= 64;
+          }
+          break;
+        }
+
+        case REFERENCE_NODE:
+          h = hashCombine(h, static_cast<ReferenceNode*>(this)->getValue());
+          break;
+
+        case STRING_NODE:
+          h = hashCombine(h, hashString(static_cast<StringNode*>(this)->getValue()));
+          break;
+
+        case VARIABLE_NODE:
+          h = hashCombine(h, hashString(static_cast<VariableNode*>(this)->getValue()));
+          break;
+
+        default:
+          break;
+      }
+
+      if (isCommutative(this->getKind())) {
+        /* A sum does not depend on the order of the childs */
+        triton::uint64 sum = 0;
+        for (triton::uint32 index = 0; index < this->childs.size(); index++)
+          sum += hashMix(this->childs[index]->getHash());
+        h = hashCombine(h, sum);
+      }
+      else {
+        for (triton::uint32 index = 0; index < this->childs.size(); index++)
+          h = hashCombine(h, this->childs[index]->getHash());
+      }
+
+      this->hash = h;
+    }
+
+
     triton::uint512 AbstractNode::evaluate(void) const {
-      return this->eval;
+      if (this->dirty)
+        this->computeDirtyEvals();
+
+      if (this->size <= 64 || this->wideEval == nullptr)
+        return this->nativeEval;
+
+      return *this->wideEval;
     }
 
 
-    std::vector<AbstractNode*>& AbstractNode::getChilds(void) {
+    triton::uint64 AbstractNode::evaluateNative(void) const {
+      if (this->dirty)
+        this->computeDirtyEvals();
+
+      if (this->size <= 64 || this->wideEval == nullptr)
+        return this->nativeEval;
+
+      return (*this->wideEval & 0xffffffffffffffffULL).convert_to<triton::uint64>();
+    }
+
+
+    void AbstractNode::computeEval(void) const {
+      /* Leaves compute their value in init() */
+      this->dirty = false;
+    }
+
+
+    void AbstractNode::computeDirtyEvals(void) const {
+      /* Most of the time the childs are already evaluated */
+      bool dirtyChilds = false;
+      for (triton::uint32 index = 0; !dirtyChilds && index < this->childs.size(); index++)
+        dirtyChilds = this->childs[index]->dirty;
+
+      if (!dirtyChilds) {
+        this->computeEval();
+        return;
+      }
+
+      /* Otherwise, the childs are evaluated before their parents so that computeEval() does not recurse */
+      triton::ast::postOrderWalk<const AbstractNode*>(this,
+        [](const AbstractNode* node, std::vector<const AbstractNode*>& successors) {
+          if (!node->dirty)
+            return false;
+          for (triton::uint32 index = 0; index < node->childs.size(); index++)
+            successors.push_back(node->childs[index]);
+          return true;
+        },
+        [](const AbstractNode* node) {
+          if (node->dirty)
+            node->computeEval();
+        });
+    }
+
+
+    void AbstractNode::setEval(const triton::uint512& value) const {
+      this->nativeEval = (value & 0xffffffffffffffffULL).convert_to<triton::uint64>();
+      if (this->size > 64)
+        this->setWideEval(value);
+      this->dirty = false;
+    }
+
+
+    void AbstractNode::setWideEval(const triton::uint512& value) const {
+      if (this->wideEval == nullptr) {
+        void* block = triton::ast::AstAllocator::getInstance().allocateOutOfLine(sizeof(triton::uint512));
+        if (block == nullptr)
+          throw std::bad_alloc();
+        this->wideEval = new (block) triton::uint512(value);
+        return;
+      }
+      *this->wideEval = value;
+    }
+
+
+    void AbstractNode::setNativeEval(triton::uint64 value) const {
+      this->nativeEval = value;
+      this->dirty      = false;
+    }
+
+
+    triton::uint32 AbstractNode::getReferenceCount(void) const {
+      return this->references;
+    }
+
+
+    void AbstractNode::incReferenceCount(void) {
+      this->references++;
+    }
+
+
+    triton::uint32 AbstractNode::decReferenceCount(void) {
+      if (this->references != 0)
+        this->references--;
+      return this->references;
+    }
+
+
+    triton::uint32 AbstractNode::getRecordIndex(void) const {
+      return this->recordIndex;
+    }
+
+
+    void AbstractNode::setRecordIndex(triton::uint32 index) {
+      this->recordIndex = index;
+    }
+
+
+    ChildVector& AbstractNode::getChilds(void) {
       return this->childs;
     }
 
 
-    std::set<AbstractNode*>& AbstractNode::getParents(void) {
+    ParentVector& AbstractNode::getParents(void) {
       return this->parents;
     }
 
 
     void AbstractNode::setParent(AbstractNode* p) {
-      this->parents.insert(p);
+      /* A parent is linked once, when the link is made (See: addChild(), setChild() and ReferenceNode) */
+      this->parents.push_back(p);
     }
 
 
     void AbstractNode::removeParent(AbstractNode* p) {
-      this->parents.erase(p);
+      /*
+       * The order does not matter, the last entry takes the place of the removed one. The parents
+       * removed are mostly the last linked ones (duplicates of hash-consed nodes, freed nodes), so
+       * they are looked for from the end: a shared node such as bv(1, 1) may have many parents.
+       */
+      for (AbstractNode** it = this->parents.end(); it != this->parents.begin();) {
+        if (*--it == p) {
+          *it = this->parents.back();
+          this->parents.pop_back();
+          return;
+        }
+      }
     }
 
 
-    void AbstractNode::setParent(std::set<AbstractNode*>& p) {
-      for (std::set<AbstractNode*>::iterator it = p.begin(); it != p.end(); it++)
-        this->parents.insert(*it);
+    void AbstractNode::setParent(ParentVector& p) {
+      for (triton::uint32 index = 0; index < p.size(); index++) {
+        if (std::find(this->parents.begin(), this->parents.end(), p[index]) == this->parents.end())
+          this->parents.push_back(p[index]);
+      }
     }
 
 
     void AbstractNode::addChild(AbstractNode* child) {
+      child->incReferenceCount();
+
+      /* A node which is twice a child has its parent once */
+      if (std::find(this->childs.begin(), this->childs.end(), child) == this->childs.end())
+        child->setParent(this);
+
       this->childs.push_back(child);
     }
 
 
+    void AbstractNode::init(void) {
+      std::unordered_set<AbstractNode*> visited;
+      std::vector<AbstractNode*> ancestors;
+
+      this->initNode();
+      if (this->parents.empty())
+        return;
+
+      /* Each ancestor comes after all its own ancestors */
+      triton::ast::postOrderWalk(static_cast<AbstractNode*>(this),
+        [&visited](AbstractNode* node, std::vector<AbstractNode*>& successors) {
+          if (!visited.insert(node).second)
+            return false;
+          successors.insert(successors.end(), node->getParents().begin(), node->getParents().end());
+          return true;
+        },
+        [&ancestors](AbstractNode* node) {
+          ancestors.push_back(node);
+        });
+
+      /* So in reverse, each ancestor comes after all the nodes it depends on. The last one is the node itself. */
+      ancestors.pop_back();
+      for (auto it = ancestors.rbegin(); it != ancestors.rend(); it++)
+        (*it)->initNode();
+    }
+
+
     void AbstractNode::setChild(triton::uint32 index, AbstractNode* child) {
       if (index >= this->childs.size())
         throw triton::exceptions::Ast("AbstractNode::setChild(): Invalid index.");
@@ -139,14 +515,39 @@ namespace triton {
       if (child == nullptr)
         throw triton::exceptions::Ast("AbstractNode::setChild(): child cannot be null.");
 
-      /* Setup the parent of the child */
-      child->setParent(this);
-
-      /* Remove the parent of the old child */
-      this->childs[index]->removeParent(this);
+      AbstractNode* old = this->childs[index];
 
       /* Setup the child of the parent */
+      child->incReferenceCount();
       this->childs[index] = child;
+
+      /* Setup the parent of the child and remove the parent of the old child, unless they are still linked */
+      if (child != old) {
+        if (std::count(this->childs.begin(), this->childs.end(), child) == 1)
+          child->setParent(this);
+        if (std::find(this->childs.begin(), this->childs.end(), old) == this->childs.end())
+          old->removeParent(this);
+      }
+      old->decReferenceCount();
+
+      /* A node nobody references is not part of a tree in use yet */
+      if (this->references != 0)
+        AbstractNode::nextGeneration();
+    }
+
+
+    triton::usize AbstractNode::getGeneration(void) {
+      return AbstractNode::generation;
+    }
+
+
+    void AbstractNode::nextGeneration(void) {
+      AbstractNode::generation++;
+    }
+
+
+    triton::usize AbstractNode::getFreedNodes(void) {
+      return AbstractNode::freedNodes;
     }
 
 
@@ -173,23 +574,21 @@ namespace triton {
     }
 
 
-    void AssertNode::init(void) {
+    void AssertNode::initNode(void) {
       if (this->childs.size() < 1)
         throw triton::exceptions::Ast("AssertNode::init(): Must take at least one child.");
 
       /* Init attributes */
       this->size = 1;
-      this->eval = 0;
+      this->setNativeEval(0);
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -198,15 +597,6 @@ namespace triton {
     }
 
 
-    triton::uint512 AssertNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvadd */
 
 
@@ -226,7 +616,7 @@ namespace triton {
     }
 
 
-    void BvaddNode::init(void) {
+    void BvaddNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvaddNode::init(): Must take at least two childs.");
 
@@ -235,31 +625,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() + this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvaddNode::accept(AstVisitor& v) {
-       v(*this);
+    void BvaddNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval((this->childs[0]->evaluateNative() + this->childs[1]->evaluateNative()) & this->getNativeMask());
+      else
+        this->setEval(((this->childs[0]->evaluate() + this->childs[1]->evaluate()) & this->getBitvectorMask()));
     }
 
 
-    triton::uint512 BvaddNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvaddNode::accept(AstVisitor& v) {
+       v(*this);
     }
 
 
@@ -282,7 +669,7 @@ namespace triton {
     }
 
 
-    void BvandNode::init(void) {
+    void BvandNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvandNode::init(): Must take at least two childs.");
 
@@ -291,31 +678,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() & this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvandNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvandNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() & this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() & this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 BvandNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvandNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -339,22 +723,46 @@ namespace triton {
     }
 
 
-    void BvashrNode::init(void) {
-      triton::uint32 shift  = 0;
-      triton::uint512 mask  = 0;
-      triton::uint512 value = 0;
-
+    void BvashrNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvashrNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvashrNode::init(): Must take two nodes of same size.");
 
-      value = this->childs[0]->evaluate();
-      shift = this->childs[1]->evaluate().convert_to<triton::uint32>();
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
+      this->dirty = true;
+
+      /* Spread information of the childs */
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->symbolized |= this->childs[index]->isSymbolized();
+      }
+
+      /* Init the structural hash */
+      this->initHash();
+    }
+
+
+    void BvashrNode::computeEval(void) const {
+      triton::uint32 shift  = 0;
+      triton::uint512 mask  = 0;
+      triton::uint512 value = 0;
+
+      if (this->size <= 64) {
+        triton::uint64 nativeValue = this->childs[0]->evaluateNative();
+        triton::uint64 nativeShift = this->childs[1]->evaluateNative();
+        if (nativeShift >= this->size)
+          this->setNativeEval(this->childs[0]->isSigned() ? this->getNativeMask() : 0);
+        else if (nativeShift == 0 || !this->childs[0]->isSigned())
+          this->setNativeEval(nativeValue >> nativeShift);
+        else
+          this->setNativeEval(((nativeValue >> nativeShift) | (this->getNativeMask() << (this->size - nativeShift))) & this->getNativeMask());
+        return;
+      }
+
+      value = this->childs[0]->evaluate();
+      shift = this->childs[1]->evaluate().convert_to<triton::uint32>();
 
       /* Mask based on the sign */
       if (this->childs[0]->isSigned()) {
@@ -363,34 +771,24 @@ namespace triton {
       }
 
       if (shift >= this->size && this->childs[0]->isSigned()) {
-        this->eval = -1;
-        this->eval &= this->getBitvectorMask();
+        this->setEval(this->getBitvectorMask());
       }
 
       else if (shift >= this->size && !this->childs[0]->isSigned()) {
-        this->eval = 0;
+        this->setEval(0);
       }
 
       else if (shift == 0) {
-        this->eval = value;
+        this->setEval(value);
       }
 
       else {
-        this->eval = value & this->getBitvectorMask();
+        value &= this->getBitvectorMask();
         for (triton::uint32 index = 0; index < shift; index++) {
-          this->eval = (((this->eval >> 1) | mask) & this->getBitvectorMask());
+          value = (((value >> 1) | mask) & this->getBitvectorMask());
         }
+        this->setEval(value);
       }
-
-      /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
-        this->symbolized |= this->childs[index]->isSymbolized();
-      }
-
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
     }
 
 
@@ -399,15 +797,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvashrNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvdecl */
 
 
@@ -426,7 +815,7 @@ namespace triton {
     }
 
 
-    void BvdeclNode::init(void) {
+    void BvdeclNode::initNode(void) {
       triton::uint32 size = 0;
 
       if (this->childs.size() < 1)
@@ -444,17 +833,15 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = 0;
+      this->setEval(0);
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -463,15 +850,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvdeclNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== bvlshr (shift with zero filled) */
 
 
@@ -491,7 +869,7 @@ namespace triton {
     }
 
 
-    void BvlshrNode::init(void) {
+    void BvlshrNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvlshrNode::init(): Must take at least two childs.");
 
@@ -500,31 +878,31 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() >> this->childs[1]->evaluate().convert_to<triton::uint32>());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvlshrNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvlshrNode::computeEval(void) const {
+      if (this->size <= 64) {
+        triton::uint64 shift = this->childs[1]->evaluateNative();
+        this->setNativeEval(shift >= this->size ? 0 : this->childs[0]->evaluateNative() >> shift);
+        return;
+      }
+
+      this->setEval(this->childs[0]->evaluate() >> this->childs[1]->evaluate().convert_to<triton::uint32>());
     }
 
 
-    triton::uint512 BvlshrNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvlshrNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -547,7 +925,7 @@ namespace triton {
     }
 
 
-    void BvmulNode::init(void) {
+    void BvmulNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvmulNode::init(): Must take at least two childs.");
 
@@ -556,31 +934,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() * this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvmulNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvmulNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval((this->childs[0]->evaluateNative() * this->childs[1]->evaluateNative()) & this->getNativeMask());
+      else
+        this->setEval(((this->childs[0]->evaluate() * this->childs[1]->evaluate()) & this->getBitvectorMask()));
     }
 
 
-    triton::uint512 BvmulNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvmulNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -603,7 +978,7 @@ namespace triton {
     }
 
 
-    void BvnandNode::init(void) {
+    void BvnandNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvnandNode::init(): Must take at least two childs.");
 
@@ -612,31 +987,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() & this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvnandNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvnandNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(~(this->childs[0]->evaluateNative() & this->childs[1]->evaluateNative()) & this->getNativeMask());
+      else
+        this->setEval((~(this->childs[0]->evaluate() & this->childs[1]->evaluate()) & this->getBitvectorMask()));
     }
 
 
-    triton::uint512 BvnandNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvnandNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -658,37 +1030,34 @@ namespace triton {
     }
 
 
-    void BvnegNode::init(void) {
+    void BvnegNode::initNode(void) {
       if (this->childs.size() < 1)
         throw triton::exceptions::Ast("BvnegNode::init(): Must take at least one child.");
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((-(this->childs[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvnegNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvnegNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval((0 - this->childs[0]->evaluateNative()) & this->getNativeMask());
+      else
+        this->setEval(((-(this->childs[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask()));
     }
 
 
-    triton::uint512 BvnegNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvnegNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -711,7 +1080,7 @@ namespace triton {
     }
 
 
-    void BvnorNode::init(void) {
+    void BvnorNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvnorNode::init(): Must take at least two childs.");
 
@@ -720,31 +1089,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() | this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvnorNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvnorNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(~(this->childs[0]->evaluateNative() | this->childs[1]->evaluateNative()) & this->getNativeMask());
+      else
+        this->setEval((~(this->childs[0]->evaluate() | this->childs[1]->evaluate()) & this->getBitvectorMask()));
     }
 
 
-    triton::uint512 BvnorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvnorNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -766,37 +1132,34 @@ namespace triton {
     }
 
 
-    void BvnotNode::init(void) {
+    void BvnotNode::initNode(void) {
       if (this->childs.size() < 1)
         throw triton::exceptions::Ast("BvnotNode::init(): Must take at least one child.");
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~this->childs[0]->evaluate() & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvnotNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvnotNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(~this->childs[0]->evaluateNative() & this->getNativeMask());
+      else
+        this->setEval((~this->childs[0]->evaluate() & this->getBitvectorMask()));
     }
 
 
-    triton::uint512 BvnotNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvnotNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -819,7 +1182,7 @@ namespace triton {
     }
 
 
-    void BvorNode::init(void) {
+    void BvorNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvorNode::init(): Must take at least two childs.");
 
@@ -828,31 +1191,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() | this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvorNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvorNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() | this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() | this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 BvorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvorNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -884,47 +1244,43 @@ namespace triton {
     }
 
 
-    void BvrolNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
-
+    void BvrolNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvrolNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrolNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
-
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      rot %= this->size;
-      this->eval = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvrolNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvrolNode::computeEval(void) const {
+      triton::uint32 rot = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>() % this->size;
+
+      if (this->size <= 64) {
+        triton::uint64 value = this->childs[1]->evaluateNative();
+        this->setNativeEval(rot == 0 ? value : ((value << rot) | (value >> (this->size - rot))) & this->getNativeMask());
+        return;
+      }
+
+      triton::uint512 value = this->childs[1]->evaluate();
+      this->setEval(((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
     }
 
 
-    triton::uint512 BvrolNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvrolNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -955,47 +1311,43 @@ namespace triton {
     }
 
 
-    void BvrorNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
-
+    void BvrorNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvrorNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrorNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
-
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      rot %= this->size;
-      this->eval = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvrorNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvrorNode::computeEval(void) const {
+      triton::uint32 rot = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>() % this->size;
+
+      if (this->size <= 64) {
+        triton::uint64 value = this->childs[1]->evaluateNative();
+        this->setNativeEval(rot == 0 ? value : ((value >> rot) | (value << (this->size - rot))) & this->getNativeMask());
+        return;
+      }
+
+      triton::uint512 value = this->childs[1]->evaluate();
+      this->setEval(((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
     }
 
 
-    triton::uint512 BvrorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvrorNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1018,53 +1370,41 @@ namespace triton {
     }
 
 
-    void BvsdivNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
+    void BvsdivNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsdivNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsdivNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
+      this->dirty = true;
 
-      if (op2Signed == 0) {
-        this->eval = (op1Signed < 0 ? 1 : -1);
-        this->eval &= this->getBitvectorMask();
-      }
-      else
-        this->eval = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
-
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvsdivNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvsdivNode::computeEval(void) const {
+      /* Sign extend */
+      triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+      triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+      if (op2Signed == 0)
+        this->setEval(triton::uint512(op1Signed < 0 ? 1 : -1) & this->getBitvectorMask());
+      else
+        this->setEval((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
     }
 
 
-    triton::uint512 BvsdivNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvsdivNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1087,47 +1427,43 @@ namespace triton {
     }
 
 
-    void BvsgeNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
+    void BvsgeNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed >= op2Signed);
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvsgeNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvsgeNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64) {
+        this->setNativeEval(triton::ast::nativeSignExtend(this->childs[0]) >= triton::ast::nativeSignExtend(this->childs[1]));
+        return;
+      }
+
+      /* Sign extend */
+      triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+      triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+      this->setEval(op1Signed >= op2Signed);
     }
 
 
-    triton::uint512 BvsgeNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvsgeNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1150,47 +1486,43 @@ namespace triton {
     }
 
 
-    void BvsgtNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
+    void BvsgtNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed > op2Signed);
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvsgtNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvsgtNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64) {
+        this->setNativeEval(triton::ast::nativeSignExtend(this->childs[0]) > triton::ast::nativeSignExtend(this->childs[1]));
+        return;
+      }
+
+      /* Sign extend */
+      triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+      triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+      this->setEval(op1Signed > op2Signed);
     }
 
 
-    triton::uint512 BvsgtNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvsgtNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1213,7 +1545,7 @@ namespace triton {
     }
 
 
-    void BvshlNode::init(void) {
+    void BvshlNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvshlNode::init(): Must take at least two childs.");
 
@@ -1222,31 +1554,31 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() << this->childs[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvshlNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvshlNode::computeEval(void) const {
+      if (this->size <= 64) {
+        triton::uint64 shift = this->childs[1]->evaluateNative();
+        this->setNativeEval(shift >= this->size ? 0 : (this->childs[0]->evaluateNative() << shift) & this->getNativeMask());
+        return;
+      }
+
+      this->setEval((this->childs[0]->evaluate() << this->childs[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
     }
 
 
-    triton::uint512 BvshlNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvshlNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1269,47 +1601,43 @@ namespace triton {
     }
 
 
-    void BvsleNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
+    void BvsleNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsleNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsleNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed <= op2Signed);
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvsleNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvsleNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64) {
+        this->setNativeEval(triton::ast::nativeSignExtend(this->childs[0]) <= triton::ast::nativeSignExtend(this->childs[1]));
+        return;
+      }
+
+      /* Sign extend */
+      triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+      triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+      this->setEval(op1Signed <= op2Signed);
     }
 
 
-    triton::uint512 BvsleNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvsleNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1332,47 +1660,43 @@ namespace triton {
     }
 
 
-    void BvsltNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
+    void BvsltNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsltNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsltNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed < op2Signed);
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvsltNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvsltNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64) {
+        this->setNativeEval(triton::ast::nativeSignExtend(this->childs[0]) < triton::ast::nativeSignExtend(this->childs[1]));
+        return;
+      }
+
+      /* Sign extend */
+      triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+      triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+      this->setEval(op1Signed < op2Signed);
     }
 
 
-    triton::uint512 BvsltNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvsltNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1395,51 +1719,41 @@ namespace triton {
     }
 
 
-    void BvsmodNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
+    void BvsmodNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsmodNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsmodNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
+      this->dirty = true;
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
-
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvsmodNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvsmodNode::computeEval(void) const {
+      /* Sign extend */
+      triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+      triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+      if (op2Signed == 0)
+        this->setEval(this->childs[0]->evaluate());
+      else
+        this->setEval((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
     }
 
 
-    triton::uint512 BvsmodNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvsmodNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1462,51 +1776,41 @@ namespace triton {
     }
 
 
-    void BvsremNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
+    void BvsremNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsremNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsremNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
+      this->dirty = true;
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
-
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvsremNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvsremNode::computeEval(void) const {
+      /* Sign extend */
+      triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+      triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+      if (op2Signed == 0)
+        this->setEval(this->childs[0]->evaluate());
+      else
+        this->setEval((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
     }
 
 
-    triton::uint512 BvsremNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvsremNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1529,7 +1833,7 @@ namespace triton {
     }
 
 
-    void BvsubNode::init(void) {
+    void BvsubNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsubNode::init(): Must take at least two childs.");
 
@@ -1538,31 +1842,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() - this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvsubNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvsubNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval((this->childs[0]->evaluateNative() - this->childs[1]->evaluateNative()) & this->getNativeMask());
+      else
+        this->setEval(((this->childs[0]->evaluate() - this->childs[1]->evaluate()) & this->getBitvectorMask()));
     }
 
 
-    triton::uint512 BvsubNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvsubNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1585,7 +1886,7 @@ namespace triton {
     }
 
 
-    void BvudivNode::init(void) {
+    void BvudivNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvudivNode::init(): Must take at least two childs.");
 
@@ -1594,35 +1895,34 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
+      this->dirty = true;
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = (-1 & this->getBitvectorMask());
-      else
-        this->eval = (this->childs[0]->evaluate() / this->childs[1]->evaluate());
-
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvudivNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvudivNode::computeEval(void) const {
+      if (this->size <= 64) {
+        triton::uint64 op2 = this->childs[1]->evaluateNative();
+        this->setNativeEval(op2 == 0 ? this->getNativeMask() : this->childs[0]->evaluateNative() / op2);
+        return;
+      }
+
+      if (this->childs[1]->evaluate() == 0)
+        this->setEval(-1 & this->getBitvectorMask());
+      else
+        this->setEval(this->childs[0]->evaluate() / this->childs[1]->evaluate());
     }
 
 
-    triton::uint512 BvudivNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvudivNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1645,7 +1945,7 @@ namespace triton {
     }
 
 
-    void BvugeNode::init(void) {
+    void BvugeNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvugeNode::init(): Must take at least two childs.");
 
@@ -1654,31 +1954,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() >= this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvugeNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvugeNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() >= this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() >= this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 BvugeNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvugeNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1701,7 +1998,7 @@ namespace triton {
     }
 
 
-    void BvugtNode::init(void) {
+    void BvugtNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvugtNode::init(): Must take at least two childs.");
 
@@ -1710,31 +2007,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() > this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvugtNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvugtNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() > this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() > this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 BvugtNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvugtNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1757,7 +2051,7 @@ namespace triton {
     }
 
 
-    void BvuleNode::init(void) {
+    void BvuleNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvuleNode::init(): Must take at least two childs.");
 
@@ -1766,31 +2060,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() <= this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvuleNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvuleNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() <= this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() <= this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 BvuleNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvuleNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1813,7 +2104,7 @@ namespace triton {
     }
 
 
-    void BvultNode::init(void) {
+    void BvultNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvultNode::init(): Must take at least two childs.");
 
@@ -1822,31 +2113,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() < this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvultNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvultNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() < this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() < this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 BvultNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvultNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1869,7 +2157,7 @@ namespace triton {
     }
 
 
-    void BvuremNode::init(void) {
+    void BvuremNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvuremNode::init(): Must take at least two childs.");
 
@@ -1878,35 +2166,34 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
+      this->dirty = true;
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = (this->childs[0]->evaluate() % this->childs[1]->evaluate());
-
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvuremNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvuremNode::computeEval(void) const {
+      if (this->size <= 64) {
+        triton::uint64 op2 = this->childs[1]->evaluateNative();
+        this->setNativeEval(op2 == 0 ? this->childs[0]->evaluateNative() : this->childs[0]->evaluateNative() % op2);
+        return;
+      }
+
+      if (this->childs[1]->evaluate() == 0)
+        this->setEval(this->childs[0]->evaluate());
+      else
+        this->setEval(this->childs[0]->evaluate() % this->childs[1]->evaluate());
     }
 
 
-    triton::uint512 BvuremNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvuremNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1929,7 +2216,7 @@ namespace triton {
     }
 
 
-    void BvxnorNode::init(void) {
+    void BvxnorNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvxnorNode::init(): Must take at least two childs.");
 
@@ -1938,31 +2225,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() ^ this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvxnorNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvxnorNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(~(this->childs[0]->evaluateNative() ^ this->childs[1]->evaluateNative()) & this->getNativeMask());
+      else
+        this->setEval((~(this->childs[0]->evaluate() ^ this->childs[1]->evaluate()) & this->getBitvectorMask()));
     }
 
 
-    triton::uint512 BvxnorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvxnorNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -1985,7 +2269,7 @@ namespace triton {
     }
 
 
-    void BvxorNode::init(void) {
+    void BvxorNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvxorNode::init(): Must take at least two childs.");
 
@@ -1994,31 +2278,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() ^ this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvxorNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvxorNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() ^ this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() ^ this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 BvxorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void BvxorNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2041,9 +2322,8 @@ namespace triton {
     }
 
 
-    void BvNode::init(void) {
-      triton::uint512 value = 0;
-      triton::uint32 size   = 0;
+    void BvNode::initNode(void) {
+      triton::uint32 size = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvNode::init(): Must take at least two childs.");
@@ -2051,8 +2331,7 @@ namespace triton {
       if (this->childs[0]->getKind() != DECIMAL_NODE || this->childs[1]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvNode::init(): Size and value must be a DECIMAL_NODE.");
 
-      value = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue();
-      size  = reinterpret_cast<DecimalNode*>(this->childs[1])->getValue().convert_to<triton::uint32>();
+      size = reinterpret_cast<DecimalNode*>(this->childs[1])->getValue().convert_to<triton::uint32>();
 
       if (!size)
         throw triton::exceptions::Ast("BvNode::init(): Size connot be equal to zero.");
@@ -2062,31 +2341,25 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = (value & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void BvNode::accept(AstVisitor& v) {
-      v(*this);
+    void BvNode::computeEval(void) const {
+      this->setEval(reinterpret_cast<DecimalNode*>(this->childs[0])->getValue() & this->getBitvectorMask());
     }
 
 
-    triton::uint512 BvNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void BvNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2109,23 +2382,21 @@ namespace triton {
     }
 
 
-    void CompoundNode::init(void) {
+    void CompoundNode::initNode(void) {
       if (this->childs.size() < 1)
         throw triton::exceptions::Ast("CompoundNode::init(): Must take at least one child.");
 
       /* Init attributes */
       this->size = 0;
-      this->eval = 0;
+      this->setNativeEval(0);
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2134,15 +2405,6 @@ namespace triton {
     }
 
 
-    triton::uint512 CompoundNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== concat */
 
 
@@ -2178,7 +2440,7 @@ namespace triton {
     }
 
 
-    void ConcatNode::init(void) {
+    void ConcatNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("ConcatNode::init(): Must take at least two childs.");
 
@@ -2191,33 +2453,38 @@ namespace triton {
       if (this->size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ConcatNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = this->childs[0]->evaluate();
-      for (triton::uint32 index = 0; index < this->childs.size()-1; index++)
-        this->eval = ((this->eval << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void ConcatNode::accept(AstVisitor& v) {
-      v(*this);
+    void ConcatNode::computeEval(void) const {
+      if (this->size <= 64) {
+        triton::uint64 value = this->childs[0]->evaluateNative();
+        for (triton::uint32 index = 0; index < this->childs.size()-1; index++) {
+          triton::uint32 shift = this->childs[index+1]->getBitvectorSize();
+          value = (((shift < 64) ? (value << shift) : 0) | this->childs[index+1]->evaluateNative());
+        }
+        this->setNativeEval(value);
+        return;
+      }
+
+      triton::uint512 value = this->childs[0]->evaluate();
+      for (triton::uint32 index = 0; index < this->childs.size()-1; index++)
+        value = ((value << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate());
+      this->setEval(value);
     }
 
 
-    triton::uint512 ConcatNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void ConcatNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2225,34 +2492,54 @@ namespace triton {
 
 
     DecimalNode::DecimalNode(triton::uint512 value) {
-      this->kind  = DECIMAL_NODE;
-      this->value = value;
+      this->kind      = DECIMAL_NODE;
+      this->wideValue = nullptr;
+      this->setValue(value);
       this->init();
     }
 
 
     DecimalNode::DecimalNode(const DecimalNode& copy) : AbstractNode(copy) {
-      this->value = copy.value;
+      this->wideValue = nullptr;
+      this->setValue(copy.getValue());
     }
 
 
     DecimalNode::~DecimalNode() {
+      if (this->wideValue != nullptr) {
+        this->wideValue->~uint512();
+        triton::ast::AstAllocator::getInstance().deallocateOutOfLine(this->wideValue, sizeof(triton::uint512));
+      }
     }
 
 
-    void DecimalNode::init(void) {
+    void DecimalNode::setValue(const triton::uint512& value) {
+      this->value = (value & 0xffffffffffffffffULL).convert_to<triton::uint64>();
+
+      /* Most decimals are sizes and indexes, only the wide ones go out of line */
+      if (value > 0xffffffffffffffffULL) {
+        void* block = triton::ast::AstAllocator::getInstance().allocateOutOfLine(sizeof(triton::uint512));
+        if (block == nullptr)
+          throw std::bad_alloc();
+        this->wideValue = new (block) triton::uint512(value);
+      }
+    }
+
+
+    void DecimalNode::initNode(void) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
+      this->setNativeEval(0);
       this->symbolized  = false;
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    triton::uint512 DecimalNode::getValue(void) {
+    triton::uint512 DecimalNode::getValue(void) const {
+      if (this->wideValue != nullptr)
+        return *this->wideValue;
       return this->value;
     }
 
@@ -2262,12 +2549,6 @@ namespace triton {
     }
 
 
-    triton::uint512 DecimalNode::hash(triton::uint32 deep) const {
-      triton::uint512 hash = this->kind ^ this->value;
-      return hash;
-    }
-
-
     /* ====== Declare node */
 
 
@@ -2287,7 +2568,7 @@ namespace triton {
     }
 
 
-    void DeclareFunctionNode::init(void) {
+    void DeclareFunctionNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("DeclareFunctionNode::init(): Must take at least two childs.");
 
@@ -2299,31 +2580,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[1]->evaluate();
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void DeclareFunctionNode::accept(AstVisitor& v) {
-      v(*this);
+    void DeclareFunctionNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(this->childs[1]->evaluateNative());
+      else
+        this->setEval(this->childs[1]->evaluate());
     }
 
 
-    triton::uint512 DeclareFunctionNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void DeclareFunctionNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2346,37 +2624,34 @@ namespace triton {
     }
 
 
-    void DistinctNode::init(void) {
+    void DistinctNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("DistinctNode::init(): Must take at least two childs.");
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() != this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void DistinctNode::accept(AstVisitor& v) {
-      v(*this);
+    void DistinctNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64 && this->childs[1]->getBitvectorSize() <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() != this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() != this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 DistinctNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void DistinctNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2399,37 +2674,34 @@ namespace triton {
     }
 
 
-    void EqualNode::init(void) {
+    void EqualNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("EqualNode::init(): Must take at least two childs.");
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() == this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void EqualNode::accept(AstVisitor& v) {
-      v(*this);
+    void EqualNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64 && this->childs[1]->getBitvectorSize() <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() == this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() == this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 EqualNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void EqualNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2453,7 +2725,7 @@ namespace triton {
     }
 
 
-    void ExtractNode::init(void) {
+    void ExtractNode::initNode(void) {
       triton::uint32 high = 0;
       triton::uint32 low  = 0;
 
@@ -2471,34 +2743,33 @@ namespace triton {
 
       /* Init attributes */
       this->size = ((high - low) + 1);
-      this->eval = ((this->childs[2]->evaluate() >> low) & this->getBitvectorMask());
+      this->dirty = true;
 
       if (this->size > this->childs[2]->getBitvectorSize() || high >= this->childs[2]->getBitvectorSize())
         throw triton::exceptions::Ast("ExtractNode::init(): The size of the extraction is higher than the child expression.");
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void ExtractNode::accept(AstVisitor& v) {
-      v(*this);
+    void ExtractNode::computeEval(void) const {
+      triton::uint32 low = reinterpret_cast<DecimalNode*>(this->childs[1])->getValue().convert_to<triton::uint32>();
+
+      if (this->childs[2]->getBitvectorSize() <= 64)
+        this->setNativeEval((this->childs[2]->evaluateNative() >> low) & this->getNativeMask());
+      else
+        this->setEval((this->childs[2]->evaluate() >> low) & this->getBitvectorMask());
     }
 
 
-    triton::uint512 ExtractNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void ExtractNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2522,7 +2793,7 @@ namespace triton {
     }
 
 
-    void IteNode::init(void) {
+    void IteNode::initNode(void) {
       if (this->childs.size() < 3)
         throw triton::exceptions::Ast("IteNode::init(): Must take at least three childs.");
 
@@ -2531,31 +2802,30 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[0]->evaluate() ? this->childs[1]->evaluate() : this->childs[2]->evaluate();
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void IteNode::accept(AstVisitor& v) {
-      v(*this);
+    void IteNode::computeEval(void) const {
+      bool condition = (this->childs[0]->getBitvectorSize() <= 64) ? (this->childs[0]->evaluateNative() != 0) : (this->childs[0]->evaluate() != 0);
+
+      if (this->size <= 64)
+        this->setNativeEval(condition ? this->childs[1]->evaluateNative() : this->childs[2]->evaluateNative());
+      else
+        this->setEval(condition ? this->childs[1]->evaluate() : this->childs[2]->evaluate());
     }
 
 
-    triton::uint512 IteNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void IteNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2578,37 +2848,34 @@ namespace triton {
     }
 
 
-    void LandNode::init(void) {
+    void LandNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("LandNode::init(): Must take at least two childs.");
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() && this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void LandNode::accept(AstVisitor& v) {
-      v(*this);
+    void LandNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64 && this->childs[1]->getBitvectorSize() <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() && this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() && this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 LandNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void LandNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2632,7 +2899,7 @@ namespace triton {
     }
 
 
-    void LetNode::init(void) {
+    void LetNode::initNode(void) {
       if (this->childs.size() < 3)
         throw triton::exceptions::Ast("LetNode::init(): Must take at least three childs.");
 
@@ -2641,31 +2908,28 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[2]->getBitvectorSize();
-      this->eval = this->childs[2]->evaluate();
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void LetNode::accept(AstVisitor& v) {
-      v(*this);
+    void LetNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(this->childs[2]->evaluateNative());
+      else
+        this->setEval(this->childs[2]->evaluate());
     }
 
 
-    triton::uint512 LetNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void LetNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2687,37 +2951,34 @@ namespace triton {
     }
 
 
-    void LnotNode::init(void) {
+    void LnotNode::initNode(void) {
       if (this->childs.size() < 1)
         throw triton::exceptions::Ast("LnotNode::init(): Must take at least one child.");
 
       /* Init attributes */
       this->size = 1;
-      this->eval = !(this->childs[0]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void LnotNode::accept(AstVisitor& v) {
-      v(*this);
+    void LnotNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64)
+        this->setNativeEval(!this->childs[0]->evaluateNative());
+      else
+        this->setEval(!(this->childs[0]->evaluate()));
     }
 
 
-    triton::uint512 LnotNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void LnotNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2740,37 +3001,34 @@ namespace triton {
     }
 
 
-    void LorNode::init(void) {
+    void LorNode::initNode(void) {
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("LorNode::init(): Must take at least two childs.");
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() || this->childs[1]->evaluate());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void LorNode::accept(AstVisitor& v) {
-      v(*this);
+    void LorNode::computeEval(void) const {
+      if (this->childs[0]->getBitvectorSize() <= 64 && this->childs[1]->getBitvectorSize() <= 64)
+        this->setNativeEval(this->childs[0]->evaluateNative() || this->childs[1]->evaluateNative());
+      else
+        this->setEval((this->childs[0]->evaluate() || this->childs[1]->evaluate()));
     }
 
 
-    triton::uint512 LorNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    void LorNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2780,12 +3038,20 @@ namespace triton {
     ReferenceNode::ReferenceNode(triton::usize value) {
       this->kind  = REFERENCE_NODE;
       this->value = value;
+
+      /* A reference is a parent of the AST of the expression it points to */
+      if (triton::api.isSymbolicExpressionIdExists(this->value))
+        triton::api.getAstFromId(this->value)->setParent(this);
+
       this->init();
     }
 
 
     ReferenceNode::ReferenceNode(const ReferenceNode& copy) : AbstractNode(copy) {
       this->value = copy.value;
+
+      if (triton::api.isSymbolicExpressionIdExists(this->value))
+        triton::api.getAstFromId(this->value)->setParent(this);
     }
 
 
@@ -2793,28 +3059,25 @@ namespace triton {
     }
 
 
-    void ReferenceNode::init(void) {
+    void ReferenceNode::initNode(void) {
       /* Init attributes */
       if (!triton::api.isSymbolicExpressionIdExists(this->value)) {
-        this->eval        = 0;
         this->size        = 0;
         this->symbolized  = false;
+        this->setNativeEval(0);
       }
       else {
-        this->eval        = triton::api.getAstFromId(this->value)->evaluate();
         this->size        = triton::api.getAstFromId(this->value)->getBitvectorSize();
         this->symbolized  = triton::api.getAstFromId(this->value)->isSymbolized();
-
-        triton::api.getAstFromId(this->value)->setParent(this);
+        this->setEval(triton::api.getAstFromId(this->value)->evaluate());
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    triton::usize ReferenceNode::getValue(void) {
+    triton::usize ReferenceNode::getValue(void) const {
       return this->value;
     }
 
@@ -2824,12 +3087,6 @@ namespace triton {
     }
 
 
-    triton::uint512 ReferenceNode::hash(triton::uint32 deep) const {
-      triton::uint512 hash = this->kind ^ this->value;
-      return hash;
-    }
-
-
     /* ====== String node */
 
 
@@ -2849,19 +3106,18 @@ namespace triton {
     }
 
 
-    void StringNode::init(void) {
+    void StringNode::initNode(void) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
+      this->setNativeEval(0);
       this->symbolized  = false;
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    std::string StringNode::getValue(void) {
+    std::string StringNode::getValue(void) const {
       return this->value;
     }
 
@@ -2871,15 +3127,6 @@ namespace triton {
     }
 
 
-    triton::uint512 StringNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind;
-      triton::uint32 index = 1;
-      for (std::string::const_iterator it = this->value.cbegin(); it != this->value.cend(); it++)
-        h = h ^ triton::ast::pow(*it, index++);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== sx */
 
 
@@ -2899,7 +3146,7 @@ namespace triton {
     }
 
 
-    void SxNode::init(void) {
+    void SxNode::initNode(void) {
       triton::uint32 sizeExt = 0;
 
       if (this->childs.size() < 2)
@@ -2915,31 +3162,31 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("SxNode::SxNode(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = ((((this->childs[1]->evaluate() >> (this->childs[1]->getBitvectorSize()-1)) == 0) ? this->childs[1]->evaluate() : (this->childs[1]->evaluate() | ~(this->childs[1]->getBitvectorMask()))) & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void SxNode::accept(AstVisitor& v) {
-      v(*this);
+    void SxNode::computeEval(void) const {
+      if (this->size <= 64) {
+        triton::uint64 value = this->childs[1]->evaluateNative();
+        this->setNativeEval((this->childs[1]->isSigned() ? (value | ~this->childs[1]->getNativeMask()) : value) & this->getNativeMask());
+        return;
+      }
+
+      this->setEval(((((this->childs[1]->evaluate() >> (this->childs[1]->getBitvectorSize()-1)) == 0) ? this->childs[1]->evaluate() : (this->childs[1]->evaluate() | ~(this->childs[1]->getBitvectorMask()))) & this->getBitvectorMask()));
     }
 
 
-    triton::uint512 SxNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void SxNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
@@ -2962,25 +3209,24 @@ namespace triton {
     }
 
 
-    void VariableNode::init(void) {
+    void VariableNode::initNode(void) {
       triton::engines::symbolic::SymbolicVariable* symVar = nullptr;
 
       symVar = triton::api.getSymbolicVariableFromName(this->value);
       if (symVar) {
         this->size        = symVar->getSize();
-        this->eval        = (symVar->getConcreteValue() & this->getBitvectorMask());
         this->symbolized  = true;
+        this->setEval(symVar->getConcreteValue() & this->getBitvectorMask());
       }
       else
         throw triton::exceptions::Ast("VariableNode::init(): Variable not found.");
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    std::string VariableNode::getValue(void) {
+    std::string VariableNode::getValue(void) const {
       return this->value;
     }
 
@@ -2990,15 +3236,6 @@ namespace triton {
     }
 
 
-    triton::uint512 VariableNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind;
-      triton::uint32 index = 1;
-      for (std::string::const_iterator it = this->value.cbegin(); it != this->value.cend(); it++)
-        h = h ^ triton::ast::pow(*it, index++);
-      return triton::ast::rotl(h, deep);
-    }
-
-
     /* ====== zx */
 
 
@@ -3018,7 +3255,7 @@ namespace triton {
     }
 
 
-    void ZxNode::init(void) {
+    void ZxNode::initNode(void) {
       triton::uint32 sizeExt = 0;
 
       if (this->childs.size() < 2)
@@ -3034,31 +3271,28 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ZxNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = (this->childs[1]->evaluate() & this->getBitvectorMask());
+      this->dirty = true;
 
-      /* Init childs and spread information */
+      /* Spread information of the childs */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void ZxNode::accept(AstVisitor& v) {
-      v(*this);
+    void ZxNode::computeEval(void) const {
+      if (this->size <= 64)
+        this->setNativeEval(this->childs[1]->evaluateNative() & this->getNativeMask());
+      else
+        this->setEval(this->childs[1]->evaluate() & this->getBitvectorMask());
     }
 
 
-    triton::uint512 ZxNode::hash(triton::uint32 deep) const {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void ZxNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
   }; /* ast namespace */
@@ -3086,21 +3320,6 @@ namespace triton {
 namespace triton {
   namespace ast {
 
-    triton::uint512 pow(triton::uint512 hash, triton::uint32 n) {
-      triton::uint512 mask = -1;
-      for (triton::uint32 i = 0; i < n; i++)
-        hash = ((hash * hash) & mask);
-      return hash;
-    }
-
-
-    triton::uint512 rotl(triton::uint512 value, triton::uint32 shift) {
-      if ((shift &= 511) == 0)
-        return value;
-      return ((value << shift) | (value >> (512 - shift)));
-    }
-
-
     triton::sint512 modularSignExtend(AbstractNode* node) {
       triton::sint512 value = 0;
 
@@ -3115,6 +3334,16 @@ namespace triton {
       return value;
     }
 
+
+    triton::sint64 nativeSignExtend(AbstractNode* node) {
+      triton::uint64 value = node->evaluateNative();
+
+      if (node->isSigned())
+        value |= ~node->getNativeMask();
+
+      return static_cast<triton::sint64>(value);
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
 
@@ -3575,12 +3804,34 @@ namespace triton {
     }
 
 
-    AbstractNode* newInstance(AbstractNode* node) {
+    AbstractNode* newInstance(AbstractNode* node, bool deep) {
       AbstractNode* newNode = nullptr;
 
       if (node == nullptr)
         return nullptr;
 
+      /*
+       * A deep copy duplicates the childs too. Each node is copied after its childs with an
+       * explicit stack, and the copies of the childs are the last ones on the stack.
+       */
+      if (deep) {
+        std::vector<AbstractNode*> copies;
+        triton::ast::postOrderWalk(node,
+          [](AbstractNode* node, std::vector<AbstractNode*>& successors) {
+            successors.insert(successors.end(), node->getChilds().begin(), node->getChilds().end());
+            return true;
+          },
+          [&copies](AbstractNode* node) {
+            AbstractNode* copy = triton::ast::newInstance(node, false);
+            triton::usize base = copies.size() - copy->getChilds().size();
+            for (triton::uint32 index = 0; index < copy->getChilds().size(); index++)
+              copy->setChild(index, copies[base + index]);
+            copies.resize(base);
+            copies.push_back(copy);
+          });
+        return copies.back();
+      }
+
       switch (node->getKind()) {
         case ASSERT_NODE:               newNode = new(std::nothrow) AssertNode(*reinterpret_cast<AssertNode*>(node)); break;
         case BVADD_NODE:                newNode = new(std::nothrow) BvaddNode(*reinterpret_cast<BvaddNode*>(node)); break;
@@ -3638,6 +3889,7 @@ namespace triton {
       if (newNode == nullptr)
         throw triton::exceptions::Ast("triton::ast::newInstance(): No enough memory.");
 
+      /* The copy shares the childs of the original node */
       return newNode;
     }
 
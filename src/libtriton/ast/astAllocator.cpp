@@ -0,0 +1,188 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <new>
+
+#include <triton/astAllocator.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the memory really taken by a block of `size` bytes */
+    static inline triton::usize getBlockSize(triton::usize size) {
+      if (size > AST_ALLOCATOR_MAX_SIZE)
+        return size;
+      return ((size + AST_ALLOCATOR_GRANULARITY - 1) / AST_ALLOCATOR_GRANULARITY) * AST_ALLOCATOR_GRANULARITY;
+    }
+
+
+    AstAllocator::AstAllocator() {
+      for (triton::usize index = 0; index < AST_ALLOCATOR_CLASSES; index++)
+        this->freeLists[index] = nullptr;
+      this->liveBlocks      = 0;
+      this->liveMemory      = 0;
+      this->outOfLineBlocks = 0;
+      this->outOfLineMemory = 0;
+    }
+
+
+    AstAllocator& AstAllocator::getInstance(void) {
+      /* Never deleted, the API may free its nodes after the static objects are destroyed */
+      static AstAllocator* instance = new AstAllocator();
+      return *instance;
+    }
+
+
+    bool AstAllocator::grow(triton::usize sizeClass) {
+      triton::usize blockSize = sizeClass * AST_ALLOCATOR_GRANULARITY;
+      triton::uint8* slab     = static_cast<triton::uint8*>(::operator new(AST_ALLOCATOR_SLAB_SIZE, std::nothrow));
+
+      if (slab == nullptr)
+        return false;
+
+      /* Thread every block of the slab into the free list */
+      for (triton::usize offset = 0; offset + blockSize <= AST_ALLOCATOR_SLAB_SIZE; offset += blockSize) {
+        *reinterpret_cast<void**>(slab + offset) = this->freeLists[sizeClass];
+        this->freeLists[sizeClass] = slab + offset;
+      }
+
+      this->slabs[slab] = sizeClass;
+      return true;
+    }
+
+
+    void* AstAllocator::allocate(triton::usize size) {
+      triton::usize sizeClass = (size + AST_ALLOCATOR_GRANULARITY - 1) / AST_ALLOCATOR_GRANULARITY;
+      void* block = nullptr;
+
+      if (size > AST_ALLOCATOR_MAX_SIZE) {
+        block = ::operator new(size, std::nothrow);
+        if (block != nullptr) {
+          this->liveBlocks++;
+          this->liveMemory += size;
+        }
+        return block;
+      }
+
+      if (this->freeLists[sizeClass] == nullptr && this->grow(sizeClass) == false)
+        return nullptr;
+
+      block = this->freeLists[sizeClass];
+      this->freeLists[sizeClass] = *reinterpret_cast<void**>(block);
+      this->liveBlocks++;
+      this->liveMemory += getBlockSize(size);
+
+      return block;
+    }
+
+
+    void AstAllocator::deallocate(void* ptr, triton::usize size) {
+      triton::usize sizeClass = (size + AST_ALLOCATOR_GRANULARITY - 1) / AST_ALLOCATOR_GRANULARITY;
+
+      if (ptr == nullptr)
+        return;
+
+      this->liveBlocks--;
+
+      if (size > AST_ALLOCATOR_MAX_SIZE) {
+        this->liveMemory -= size;
+        ::operator delete(ptr);
+        return;
+      }
+
+      *reinterpret_cast<void**>(ptr) = this->freeLists[sizeClass];
+      this->freeLists[sizeClass] = ptr;
+      this->liveMemory -= getBlockSize(size);
+    }
+
+
+    void AstAllocator::deallocate(void* ptr) {
+      triton::uint8* block = static_cast<triton::uint8*>(ptr);
+
+      if (ptr == nullptr)
+        return;
+
+      /* Look for the slab which contains the block */
+      std::map<triton::uint8*, triton::usize>::iterator it = this->slabs.upper_bound(block);
+      if (it != this->slabs.begin()) {
+        it--;
+        if (block < it->first + AST_ALLOCATOR_SLAB_SIZE) {
+          this->deallocate(ptr, it->second * AST_ALLOCATOR_GRANULARITY);
+          return;
+        }
+      }
+
+      /* Not in a slab, it is a big block. Nodes are never that big, its size is not accounted. */
+      this->liveBlocks--;
+      ::operator delete(ptr);
+    }
+
+
+    void* AstAllocator::allocateOutOfLine(triton::usize size) {
+      void* block = this->allocate(size);
+
+      if (block != nullptr) {
+        this->outOfLineBlocks++;
+        this->outOfLineMemory += getBlockSize(size);
+      }
+
+      return block;
+    }
+
+
+    void AstAllocator::deallocateOutOfLine(void* ptr, triton::usize size) {
+      if (ptr == nullptr)
+        return;
+
+      this->outOfLineBlocks--;
+      this->outOfLineMemory -= getBlockSize(size);
+      this->deallocate(ptr, size);
+    }
+
+
+    void AstAllocator::release(void) {
+      if (this->liveBlocks != 0)
+        return;
+
+      for (auto it = this->slabs.begin(); it != this->slabs.end(); it++)
+        ::operator delete(it->first);
+
+      for (triton::usize index = 0; index < AST_ALLOCATOR_CLASSES; index++)
+        this->freeLists[index] = nullptr;
+
+      this->slabs.clear();
+    }
+
+
+    triton::usize AstAllocator::getLiveBlocks(void) const {
+      return this->liveBlocks;
+    }
+
+
+    triton::usize AstAllocator::getLiveMemory(void) const {
+      return this->liveMemory;
+    }
+
+
+    triton::usize AstAllocator::getOutOfLineBlocks(void) const {
+      return this->outOfLineBlocks;
+    }
+
+
+    triton::usize AstAllocator::getOutOfLineMemory(void) const {
+      return this->outOfLineMemory;
+    }
+
+
+    triton::usize AstAllocator::getReservedMemory(void) const {
+      return this->slabs.size() * AST_ALLOCATOR_SLAB_SIZE;
+    }
+
+  }; /* ast namespace */
+}; /*triton namespace */
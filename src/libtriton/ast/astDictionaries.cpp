@@ -12,11 +12,20 @@
 namespace triton {
   namespace ast {
 
-    AstDictionaries::AstDictionaries(bool isBackup) {
+    /* Initial capacity of the table (must be a power of two) */
+    static const triton::usize initialCapacity = 1024;
+
+    /* A slot whose node has been removed. Lookups probe past it and inserts reuse it. */
+    static triton::ast::AbstractNode* const tombstone = reinterpret_cast<triton::ast::AbstractNode*>(1);
+
+
+    AstDictionaries::AstDictionaries() {
       this->allocatedNodes  = 0;
-      this->backupFlag      = isBackup;
+      this->indexedNodes    = 0;
+      this->removedSlots    = 0;
 
-      this->linkDictionaries();
+      this->table.resize(initialCapacity, nullptr);
+      this->hashes.resize(initialCapacity, 0);
     }
 
 
@@ -26,10 +35,7 @@ namespace triton {
 
 
     AstDictionaries::~AstDictionaries() {
-      if (this->backupFlag == false) {
-        for (auto it = this->allocatedDictionaries.begin(); it != this->allocatedDictionaries.end(); it++)
-          delete *it;
-      }
+      /* The canonical nodes are owned by the garbage collector */
     }
 
 
@@ -41,237 +47,235 @@ namespace triton {
     void AstDictionaries::copy(const AstDictionaries& other) {
       /* Global information */
       this->allocatedNodes              = other.allocatedNodes;
-      this->allocatedDictionaries       = other.allocatedDictionaries;
-      this->backupFlag                  = true;
-
-      /* Dictionnaries */
-      this->assertDictionary            = other.assertDictionary;
-      this->bvaddDictionary             = other.bvaddDictionary;
-      this->bvandDictionary             = other.bvandDictionary;
-      this->bvashrDictionary            = other.bvashrDictionary;
-      this->bvdeclDictionary            = other.bvdeclDictionary;
-      this->bvlshrDictionary            = other.bvlshrDictionary;
-      this->bvmulDictionary             = other.bvmulDictionary;
-      this->bvnandDictionary            = other.bvnandDictionary;
-      this->bvnegDictionary             = other.bvnegDictionary;
-      this->bvnorDictionary             = other.bvnorDictionary;
-      this->bvnotDictionary             = other.bvnotDictionary;
-      this->bvorDictionary              = other.bvorDictionary;
-      this->bvrolDictionary             = other.bvrolDictionary;
-      this->bvrorDictionary             = other.bvrorDictionary;
-      this->bvsdivDictionary            = other.bvsdivDictionary;
-      this->bvsgeDictionary             = other.bvsgeDictionary;
-      this->bvsgtDictionary             = other.bvsgtDictionary;
-      this->bvshlDictionary             = other.bvshlDictionary;
-      this->bvsleDictionary             = other.bvsleDictionary;
-      this->bvsltDictionary             = other.bvsltDictionary;
-      this->bvsmodDictionary            = other.bvsmodDictionary;
-      this->bvsremDictionary            = other.bvsremDictionary;
-      this->bvsubDictionary             = other.bvsubDictionary;
-      this->bvudivDictionary            = other.bvudivDictionary;
-      this->bvugeDictionary             = other.bvugeDictionary;
-      this->bvugtDictionary             = other.bvugtDictionary;
-      this->bvuleDictionary             = other.bvuleDictionary;
-      this->bvultDictionary             = other.bvultDictionary;
-      this->bvuremDictionary            = other.bvuremDictionary;
-      this->bvxnorDictionary            = other.bvxnorDictionary;
-      this->bvxorDictionary             = other.bvxorDictionary;
-      this->bvDictionary                = other.bvDictionary;
-      this->compoundDictionary          = other.compoundDictionary;
-      this->concatDictionary            = other.concatDictionary;
-      this->decimalDictionary           = other.decimalDictionary;
-      this->declareFunctionDictionary   = other.declareFunctionDictionary;
-      this->distinctDictionary          = other.distinctDictionary;
-      this->equalDictionary             = other.equalDictionary;
-      this->extractDictionary           = other.extractDictionary;
-      this->iteDictionary               = other.iteDictionary;
-      this->landDictionary              = other.landDictionary;
-      this->letDictionary               = other.letDictionary;
-      this->lnotDictionary              = other.lnotDictionary;
-      this->lorDictionary               = other.lorDictionary;
-      this->referenceDictionary         = other.referenceDictionary;
-      this->stringDictionary            = other.stringDictionary;
-      this->sxDictionary                = other.sxDictionary;
-      this->variableDictionary          = other.variableDictionary;
-      this->zxDictionary                = other.zxDictionary;
-
-      this->linkDictionaries();
+      this->indexedNodes                = other.indexedNodes;
+      this->removedSlots                = other.removedSlots;
+
+      /* Hash-consing table */
+      this->table                       = other.table;
+      this->hashes                      = other.hashes;
+      this->uniqueNodes                 = other.uniqueNodes;
     }
 
 
-    void AstDictionaries::linkDictionaries(void) {
-      this->dictionaries[triton::ast::ASSERT_NODE]             = &this->assertDictionary;
-      this->dictionaries[triton::ast::BVADD_NODE]              = &this->bvaddDictionary;
-      this->dictionaries[triton::ast::BVAND_NODE]              = &this->bvandDictionary;
-      this->dictionaries[triton::ast::BVASHR_NODE]             = &this->bvashrDictionary;
-      this->dictionaries[triton::ast::BVDECL_NODE]             = &this->bvdeclDictionary;
-      this->dictionaries[triton::ast::BVLSHR_NODE]             = &this->bvlshrDictionary;
-      this->dictionaries[triton::ast::BVMUL_NODE]              = &this->bvmulDictionary;
-      this->dictionaries[triton::ast::BVNAND_NODE]             = &this->bvnandDictionary;
-      this->dictionaries[triton::ast::BVNEG_NODE]              = &this->bvnegDictionary;
-      this->dictionaries[triton::ast::BVNOR_NODE]              = &this->bvnorDictionary;
-      this->dictionaries[triton::ast::BVNOT_NODE]              = &this->bvnotDictionary;
-      this->dictionaries[triton::ast::BVOR_NODE]               = &this->bvorDictionary;
-      this->dictionaries[triton::ast::BVROL_NODE]              = &this->bvrolDictionary;
-      this->dictionaries[triton::ast::BVROR_NODE]              = &this->bvrorDictionary;
-      this->dictionaries[triton::ast::BVSDIV_NODE]             = &this->bvsdivDictionary;
-      this->dictionaries[triton::ast::BVSGE_NODE]              = &this->bvsgeDictionary;
-      this->dictionaries[triton::ast::BVSGT_NODE]              = &this->bvsgtDictionary;
-      this->dictionaries[triton::ast::BVSHL_NODE]              = &this->bvshlDictionary;
-      this->dictionaries[triton::ast::BVSLE_NODE]              = &this->bvsleDictionary;
-      this->dictionaries[triton::ast::BVSLT_NODE]              = &this->bvsltDictionary;
-      this->dictionaries[triton::ast::BVSMOD_NODE]             = &this->bvsmodDictionary;
-      this->dictionaries[triton::ast::BVSREM_NODE]             = &this->bvsremDictionary;
-      this->dictionaries[triton::ast::BVSUB_NODE]              = &this->bvsubDictionary;
-      this->dictionaries[triton::ast::BVUDIV_NODE]             = &this->bvudivDictionary;
-      this->dictionaries[triton::ast::BVUGE_NODE]              = &this->bvugeDictionary;
-      this->dictionaries[triton::ast::BVUGT_NODE]              = &this->bvugtDictionary;
-      this->dictionaries[triton::ast::BVULE_NODE]              = &this->bvuleDictionary;
-      this->dictionaries[triton::ast::BVULT_NODE]              = &this->bvultDictionary;
-      this->dictionaries[triton::ast::BVUREM_NODE]             = &this->bvuremDictionary;
-      this->dictionaries[triton::ast::BVXNOR_NODE]             = &this->bvxnorDictionary;
-      this->dictionaries[triton::ast::BVXOR_NODE]              = &this->bvxorDictionary;
-      this->dictionaries[triton::ast::BV_NODE]                 = &this->bvDictionary;
-      this->dictionaries[triton::ast::COMPOUND_NODE]           = &this->compoundDictionary;
-      this->dictionaries[triton::ast::CONCAT_NODE]             = &this->concatDictionary;
-      this->dictionaries[triton::ast::DECIMAL_NODE]            = &this->decimalDictionary;
-      this->dictionaries[triton::ast::DECLARE_FUNCTION_NODE]   = &this->declareFunctionDictionary;
-      this->dictionaries[triton::ast::DISTINCT_NODE]           = &this->distinctDictionary;
-      this->dictionaries[triton::ast::EQUAL_NODE]              = &this->equalDictionary;
-      this->dictionaries[triton::ast::EXTRACT_NODE]            = &this->extractDictionary;
-      this->dictionaries[triton::ast::ITE_NODE]                = &this->iteDictionary;
-      this->dictionaries[triton::ast::LAND_NODE]               = &this->landDictionary;
-      this->dictionaries[triton::ast::LET_NODE]                = &this->letDictionary;
-      this->dictionaries[triton::ast::LNOT_NODE]               = &this->lnotDictionary;
-      this->dictionaries[triton::ast::LOR_NODE]                = &this->lorDictionary;
-      this->dictionaries[triton::ast::REFERENCE_NODE]          = &this->referenceDictionary;
-      this->dictionaries[triton::ast::STRING_NODE]             = &this->stringDictionary;
-      this->dictionaries[triton::ast::SX_NODE]                 = &this->sxDictionary;
-      this->dictionaries[triton::ast::VARIABLE_NODE]           = &this->variableDictionary;
-      this->dictionaries[triton::ast::ZX_NODE]                 = &this->zxDictionary;
+    triton::uint64 AstDictionaries::hash(triton::ast::AbstractNode* node) const {
+      /* Structurally equal nodes have the same hash, see AbstractNode::initHash() */
+      return node->getHash();
     }
 
 
-    triton::ast::AbstractNode* AstDictionaries::browseAstDictionaries(triton::ast::AbstractNode* node) {
-      this->allocatedNodes++;
-      triton::uint32 kind = node->getKind();
-
-      switch (kind) {
-
-        case triton::ast::DECIMAL_NODE: {
-          auto value       = static_cast<triton::ast::DecimalNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::uint512, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+    bool AstDictionaries::isEqual(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) const {
+      if (node1->getKind() != node2->getKind())
+        return false;
+
+      if (node1->getBitvectorSize() != node2->getBitvectorSize())
+        return false;
+
+      switch (node1->getKind()) {
+        case triton::ast::DECIMAL_NODE:
+          if (static_cast<triton::ast::DecimalNode*>(node1)->getValue() != static_cast<triton::ast::DecimalNode*>(node2)->getValue())
+            return false;
           break;
-        }
-
-        case triton::ast::REFERENCE_NODE: {
-          auto value       = static_cast<triton::ast::ReferenceNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::usize, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+
+        case triton::ast::REFERENCE_NODE:
+          if (static_cast<triton::ast::ReferenceNode*>(node1)->getValue() != static_cast<triton::ast::ReferenceNode*>(node2)->getValue())
+            return false;
           break;
-        }
-
-        case triton::ast::STRING_NODE: {
-          auto value       = static_cast<triton::ast::StringNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+
+        case triton::ast::STRING_NODE:
+          if (static_cast<triton::ast::StringNode*>(node1)->getValue() != static_cast<triton::ast::StringNode*>(node2)->getValue())
+            return false;
           break;
-        }
-
-        case triton::ast::VARIABLE_NODE: {
-          auto value       = static_cast<triton::ast::VariableNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+
+        case triton::ast::VARIABLE_NODE:
+          if (static_cast<triton::ast::VariableNode*>(node1)->getValue() != static_cast<triton::ast::VariableNode*>(node2)->getValue())
+            return false;
           break;
-        }
-
-        default: {
-          auto value       = node->getChilds();
-          auto dictionary  = static_cast<std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+
+        default:
           break;
-        }
+      }
+
+      return node1->getChilds() == node2->getChilds();
+    }
+
+
+    triton::usize AstDictionaries::find(triton::ast::AbstractNode* node) const {
+      triton::usize mask = this->table.size() - 1;
+      triton::usize slot = static_cast<triton::usize>(this->hash(node)) & mask;
+
+      while (this->table[slot] != nullptr) {
+        if (this->table[slot] == node)
+          return slot;
+        slot = (slot + 1) & mask;
+      }
+
+      /* A node changed in place since it became canonical (See: AbstractNode::setChild()) is not under its current hash */
+      for (slot = 0; slot < this->table.size(); slot++) {
+        if (this->table[slot] == node)
+          return slot;
+      }
+
+      return this->table.size();
+    }
+
+
+    void AstDictionaries::insert(triton::ast::AbstractNode* node, triton::uint64 hash) {
+      triton::usize mask = this->table.size() - 1;
+      triton::usize slot = static_cast<triton::usize>(hash) & mask;
+
+      while (this->table[slot] != nullptr && this->table[slot] != tombstone)
+        slot = (slot + 1) & mask;
+
+      if (this->table[slot] == tombstone)
+        this->removedSlots--;
+
+      this->table[slot]  = node;
+      this->hashes[slot] = hash;
+    }
 
+
+    void AstDictionaries::rehash(triton::usize capacity) {
+      std::vector<triton::ast::AbstractNode*> oldTable;
+      std::vector<triton::uint64> oldHashes;
+
+      oldTable.swap(this->table);
+      oldHashes.swap(this->hashes);
+
+      this->table.resize(capacity, nullptr);
+      this->hashes.resize(capacity, 0);
+      this->removedSlots = 0;
+
+      for (triton::usize i = 0; i < oldTable.size(); i++) {
+        if (oldTable[i] != nullptr && oldTable[i] != tombstone)
+          this->insert(oldTable[i], oldHashes[i]);
+      }
+    }
+
+
+    triton::usize AstDictionaries::getUniqueNodes(triton::uint32 kind) const {
+      auto it = this->uniqueNodes.find(kind);
+      if (it == this->uniqueNodes.end())
+        return 0;
+      return it->second;
+    }
+
+
+    triton::ast::AbstractNode* AstDictionaries::browseAstDictionaries(triton::ast::AbstractNode* node) {
+      triton::uint64 h    = this->hash(node);
+      triton::usize mask  = this->table.size() - 1;
+      triton::usize slot  = static_cast<triton::usize>(h) & mask;
+
+      this->allocatedNodes++;
+
+      /* Look for a canonical node */
+      while (this->table[slot] != nullptr) {
+        if (this->table[slot] != tombstone && this->hashes[slot] == h && this->isEqual(this->table[slot], node))
+          return this->table[slot];
+        slot = (slot + 1) & mask;
       }
 
-      this->allocatedDictionaries.insert(node);
+      /* The node is new, keep the load factor (tombstones included) under 1/2. The table only grows if the nodes fill a quarter of it. */
+      if ((this->indexedNodes + this->removedSlots + 1) * 2 > this->table.size())
+        this->rehash((this->indexedNodes + 1) * 4 > this->table.size() ? this->table.size() * 2 : this->table.size());
+
+      this->insert(node, h);
+      this->uniqueNodes[node->getKind()]++;
+      this->indexedNodes++;
+
+      /* The dictionaries reference their canonical nodes */
+      node->incReferenceCount();
+
       return nullptr;
     }
 
 
+    bool AstDictionaries::isIndexed(triton::ast::AbstractNode* node) const {
+      if (this->indexedNodes == 0)
+        return false;
+      return this->find(node) != this->table.size();
+    }
+
+
+    bool AstDictionaries::unindexAstNode(triton::ast::AbstractNode* node) {
+      if (this->indexedNodes == 0)
+        return false;
+
+      triton::usize slot = this->find(node);
+      if (slot == this->table.size())
+        return false;
+
+      /* The slot may be in the middle of a probe sequence, it becomes a tombstone */
+      this->table[slot] = tombstone;
+      this->removedSlots++;
+      this->indexedNodes--;
+      this->uniqueNodes[node->getKind()]--;
+      node->decReferenceCount();
+
+      return true;
+    }
+
+
+    void AstDictionaries::clearAstDictionaries(void) {
+      this->table.assign(initialCapacity, nullptr);
+      this->hashes.assign(initialCapacity, 0);
+      this->uniqueNodes.clear();
+      this->indexedNodes = 0;
+      this->removedSlots = 0;
+    }
+
+
     std::map<std::string, triton::usize> AstDictionaries::getAstDictionariesStats(void) const {
       std::map<std::string, triton::usize> stats;
-      stats["assert"]                 = this->assertDictionary.size();
-      stats["bvadd"]                  = this->bvaddDictionary.size();
-      stats["bvand"]                  = this->bvandDictionary.size();
-      stats["bvashr"]                 = this->bvashrDictionary.size();
-      stats["bvdecl"]                 = this->bvdeclDictionary.size();
-      stats["bvlshr"]                 = this->bvlshrDictionary.size();
-      stats["bvmul"]                  = this->bvmulDictionary.size();
-      stats["bvnand"]                 = this->bvnandDictionary.size();
-      stats["bvneg"]                  = this->bvnegDictionary.size();
-      stats["bvnor"]                  = this->bvnorDictionary.size();
-      stats["bvnot"]                  = this->bvnotDictionary.size();
-      stats["bvor"]                   = this->bvorDictionary.size();
-      stats["bvrol"]                  = this->bvrolDictionary.size();
-      stats["bvror"]                  = this->bvrorDictionary.size();
-      stats["bvsdiv"]                 = this->bvsdivDictionary.size();
-      stats["bvsge"]                  = this->bvsgeDictionary.size();
-      stats["bvsgt"]                  = this->bvsgtDictionary.size();
-      stats["bvshl"]                  = this->bvshlDictionary.size();
-      stats["bvsle"]                  = this->bvsleDictionary.size();
-      stats["bvslt"]                  = this->bvsltDictionary.size();
-      stats["bvsmod"]                 = this->bvsmodDictionary.size();
-      stats["bvsrem"]                 = this->bvsremDictionary.size();
-      stats["bvsub"]                  = this->bvsubDictionary.size();
-      stats["bvudiv"]                 = this->bvudivDictionary.size();
-      stats["bvuge"]                  = this->bvugeDictionary.size();
-      stats["bvugt"]                  = this->bvugtDictionary.size();
-      stats["bvule"]                  = this->bvuleDictionary.size();
-      stats["bvult"]                  = this->bvultDictionary.size();
-      stats["bvurem"]                 = this->bvuremDictionary.size();
-      stats["bvxnor"]                 = this->bvxnorDictionary.size();
-      stats["bvxor"]                  = this->bvxorDictionary.size();
-      stats["bv"]                     = this->bvDictionary.size();
-      stats["compound"]               = this->compoundDictionary.size();
-      stats["concat"]                 = this->concatDictionary.size();
-      stats["decimal"]                = this->decimalDictionary.size();
-      stats["declareFunction"]        = this->declareFunctionDictionary.size();
-      stats["distinct"]               = this->distinctDictionary.size();
-      stats["equal"]                  = this->equalDictionary.size();
-      stats["extract"]                = this->extractDictionary.size();
-      stats["ite"]                    = this->iteDictionary.size();
-      stats["land"]                   = this->landDictionary.size();
-      stats["let"]                    = this->letDictionary.size();
-      stats["lnot"]                   = this->lnotDictionary.size();
-      stats["lor"]                    = this->lorDictionary.size();
-      stats["reference"]              = this->referenceDictionary.size();
-      stats["string"]                 = this->stringDictionary.size();
-      stats["sx"]                     = this->sxDictionary.size();
-      stats["variable"]               = this->variableDictionary.size();
-      stats["zx"]                     = this->zxDictionary.size();
-      stats["allocatedDictionaries"]  = this->allocatedDictionaries.size();
+      stats["assert"]                 = this->getUniqueNodes(triton::ast::ASSERT_NODE);
+      stats["bvadd"]                  = this->getUniqueNodes(triton::ast::BVADD_NODE);
+      stats["bvand"]                  = this->getUniqueNodes(triton::ast::BVAND_NODE);
+      stats["bvashr"]                 = this->getUniqueNodes(triton::ast::BVASHR_NODE);
+      stats["bvdecl"]                 = this->getUniqueNodes(triton::ast::BVDECL_NODE);
+      stats["bvlshr"]                 = this->getUniqueNodes(triton::ast::BVLSHR_NODE);
+      stats["bvmul"]                  = this->getUniqueNodes(triton::ast::BVMUL_NODE);
+      stats["bvnand"]                 = this->getUniqueNodes(triton::ast::BVNAND_NODE);
+      stats["bvneg"]                  = this->getUniqueNodes(triton::ast::BVNEG_NODE);
+      stats["bvnor"]                  = this->getUniqueNodes(triton::ast::BVNOR_NODE);
+      stats["bvnot"]                  = this->getUniqueNodes(triton::ast::BVNOT_NODE);
+      stats["bvor"]                   = this->getUniqueNodes(triton::ast::BVOR_NODE);
+      stats["bvrol"]                  = this->getUniqueNodes(triton::ast::BVROL_NODE);
+      stats["bvror"]                  = this->getUniqueNodes(triton::ast::BVROR_NODE);
+      stats["bvsdiv"]                 = this->getUniqueNodes(triton::ast::BVSDIV_NODE);
+      stats["bvsge"]                  = this->getUniqueNodes(triton::ast::BVSGE_NODE);
+      stats["bvsgt"]                  = this->getUniqueNodes(triton::ast::BVSGT_NODE);
+      stats["bvshl"]                  = this->getUniqueNodes(triton::ast::BVSHL_NODE);
+      stats["bvsle"]                  = this->getUniqueNodes(triton::ast::BVSLE_NODE);
+      stats["bvslt"]                  = this->getUniqueNodes(triton::ast::BVSLT_NODE);
+      stats["bvsmod"]                 = this->getUniqueNodes(triton::ast::BVSMOD_NODE);
+      stats["bvsrem"]                 = this->getUniqueNodes(triton::ast::BVSREM_NODE);
+      stats["bvsub"]                  = this->getUniqueNodes(triton::ast::BVSUB_NODE);
+      stats["bvudiv"]                 = this->getUniqueNodes(triton::ast::BVUDIV_NODE);
+      stats["bvuge"]                  = this->getUniqueNodes(triton::ast::BVUGE_NODE);
+      stats["bvugt"]                  = this->getUniqueNodes(triton::ast::BVUGT_NODE);
+      stats["bvule"]                  = this->getUniqueNodes(triton::ast::BVULE_NODE);
+      stats["bvult"]                  = this->getUniqueNodes(triton::ast::BVULT_NODE);
+      stats["bvurem"]                 = this->getUniqueNodes(triton::ast::BVUREM_NODE);
+      stats["bvxnor"]                 = this->getUniqueNodes(triton::ast::BVXNOR_NODE);
+      stats["bvxor"]                  = this->getUniqueNodes(triton::ast::BVXOR_NODE);
+      stats["bv"]                     = this->getUniqueNodes(triton::ast::BV_NODE);
+      stats["compound"]               = this->getUniqueNodes(triton::ast::COMPOUND_NODE);
+      stats["concat"]                 = this->getUniqueNodes(triton::ast::CONCAT_NODE);
+      stats["decimal"]                = this->getUniqueNodes(triton::ast::DECIMAL_NODE);
+      stats["declareFunction"]        = this->getUniqueNodes(triton::ast::DECLARE_FUNCTION_NODE);
+      stats["distinct"]               = this->getUniqueNodes(triton::ast::DISTINCT_NODE);
+      stats["equal"]                  = this->getUniqueNodes(triton::ast::EQUAL_NODE);
+      stats["extract"]                = this->getUniqueNodes(triton::ast::EXTRACT_NODE);
+      stats["ite"]                    = this->getUniqueNodes(triton::ast::ITE_NODE);
+      stats["land"]                   = this->getUniqueNodes(triton::ast::LAND_NODE);
+      stats["let"]                    = this->getUniqueNodes(triton::ast::LET_NODE);
+      stats["lnot"]                   = this->getUniqueNodes(triton::ast::LNOT_NODE);
+      stats["lor"]                    = this->getUniqueNodes(triton::ast::LOR_NODE);
+      stats["reference"]              = this->getUniqueNodes(triton::ast::REFERENCE_NODE);
+      stats["string"]                 = this->getUniqueNodes(triton::ast::STRING_NODE);
+      stats["sx"]                     = this->getUniqueNodes(triton::ast::SX_NODE);
+      stats["variable"]               = this->getUniqueNodes(triton::ast::VARIABLE_NODE);
+      stats["zx"]                     = this->getUniqueNodes(triton::ast::ZX_NODE);
+      stats["allocatedDictionaries"]  = this->indexedNodes;
       stats["allocatedNodes"]         = this->allocatedNodes;
       return stats;
     }
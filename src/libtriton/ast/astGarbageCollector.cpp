@@ -5,7 +5,10 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <triton/api.hpp>
+#include <triton/astAllocator.hpp>
 #include <triton/astGarbageCollector.hpp>
+#include <triton/astWalker.hpp>
 #include <triton/exceptions.hpp>
 
 
@@ -14,7 +17,7 @@ namespace triton {
   namespace ast {
 
     AstGarbageCollector::AstGarbageCollector(triton::modes::Modes* modes, bool isBackup)
-      : triton::ast::AstDictionaries(isBackup) {
+      : triton::ast::AstDictionaries() {
 
       if (modes == nullptr)
         throw triton::exceptions::AstGarbageCollector("AstGarbageCollector::AstGarbageCollector(): The modes API cannot be null.");
@@ -37,12 +40,7 @@ namespace triton {
 
 
     void AstGarbageCollector::copy(const AstGarbageCollector& other) {
-      /* Remove unused nodes before the assignation */
-      for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
-        if (other.allocatedNodes.find(*it) == other.allocatedNodes.end())
-          delete *it;
-      }
-      this->allocatedNodes  = other.allocatedNodes;
+      this->assignAllocatedAstNodes(other.allocatedNodes);
       this->backupFlag      = true;
       this->modes           = other.modes;
       this->variableNodes   = other.variableNodes;
@@ -55,30 +53,85 @@ namespace triton {
     }
 
 
+    bool AstGarbageCollector::isRecorded(triton::ast::AbstractNode* node) const {
+      triton::uint32 index = node->getRecordIndex();
+      return index < this->allocatedNodes.size() && this->allocatedNodes[index] == node;
+    }
+
+
+    bool AstGarbageCollector::isUnreferenced(triton::ast::AbstractNode* node) const {
+      /* The dictionaries hold a reference on their canonical nodes */
+      switch (node->getReferenceCount()) {
+        case 0:  return true;
+        case 1:  return this->isIndexed(node);
+        default: return false;
+      }
+    }
+
+
+    bool AstGarbageCollector::unrecordAstNode(triton::ast::AbstractNode* node) {
+      if (!this->isRecorded(node))
+        return false;
+
+      triton::ast::AbstractNode* last = this->allocatedNodes.back();
+      last->setRecordIndex(node->getRecordIndex());
+      this->allocatedNodes[node->getRecordIndex()] = last;
+      this->allocatedNodes.pop_back();
+
+      return true;
+    }
+
+
+    void AstGarbageCollector::assignAllocatedAstNodes(const std::vector<triton::ast::AbstractNode*>& nodes) {
+      /* The nodes kept take their position in the new container, a node found at its position is kept */
+      for (triton::uint32 index = 0; index < nodes.size(); index++)
+        nodes[index]->setRecordIndex(index);
+
+      /* Remove unused nodes before the assignation */
+      for (triton::ast::AbstractNode* node : this->allocatedNodes) {
+        triton::uint32 index = node->getRecordIndex();
+        if (index >= nodes.size() || nodes[index] != node)
+          delete node;
+      }
+
+      this->allocatedNodes = nodes;
+    }
+
+
     void AstGarbageCollector::freeAllAstNodes(void) {
+      /* Nodes are deleted in the order they were recorded, close to their order in the slabs */
       for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++)
         delete *it;
 
       this->variableNodes.clear();
       this->allocatedNodes.clear();
+      this->clearAstDictionaries();
+
+      /* No node left (backups included), give the slabs back at once */
+      triton::ast::AstAllocator::getInstance().release();
     }
 
 
     void AstGarbageCollector::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
       std::set<triton::ast::AbstractNode*>::iterator it;
 
-      /* Do not delete AST nodes if the AST_DICTIONARIES optimization is enabled */
-      if (this->modes->isModeEnabled(triton::modes::AST_DICTIONARIES))
-        return;
-
       for (it = nodes.begin(); it != nodes.end(); it++) {
-        /* Remove the node from the global set */
-        this->allocatedNodes.erase(*it);
+        /* Remove the node from the global container and from the dictionaries */
+        this->unrecordAstNode(*it);
+        this->unindexAstNode(*it);
 
         /* Remove the node from the global variables map */
         if ((*it)->getKind() == triton::ast::VARIABLE_NODE)
           this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(*it)->getValue());
 
+        /* Release the childs which are not freed with it */
+        for (triton::ast::AbstractNode* child : (*it)->getChilds()) {
+          if (nodes.find(child) == nodes.end()) {
+            child->removeParent(*it);
+            child->decReferenceCount();
+          }
+        }
+
         /* Delete the node */
         delete *it;
       }
@@ -87,11 +140,67 @@ namespace triton {
     }
 
 
+    void AstGarbageCollector::freeUnreferencedAstNodes(std::vector<triton::ast::AbstractNode*>& roots) {
+      std::vector<triton::ast::AbstractNode*> worklist;
+
+      /* A root may be the child of another root, hold it until its turn so it is not freed twice */
+      for (triton::ast::AbstractNode* root : roots)
+        root->incReferenceCount();
+
+      for (triton::ast::AbstractNode* root : roots) {
+        root->decReferenceCount();
+        if (!this->isUnreferenced(root))
+          continue;
+
+        worklist.push_back(root);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.back();
+          worklist.pop_back();
+
+          /* Remove the node from the global container, nodes which are not recorded are not owned */
+          if (!this->unrecordAstNode(node))
+            continue;
+
+          /* Remove the node from the dictionaries, which release their reference */
+          this->unindexAstNode(node);
+
+          /* Remove the node from the global variables map */
+          if (node->getKind() == triton::ast::VARIABLE_NODE)
+            this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(node)->getValue());
+
+          /* A reference is a parent of the AST of the expression it points to */
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+            if (triton::api.isSymbolicExpressionIdExists(id))
+              triton::api.getAstFromId(id)->removeParent(node);
+          }
+
+          /* Release the childs, the ones which lose their last reference are freed too */
+          for (triton::ast::AbstractNode* child : node->getChilds()) {
+            child->removeParent(node);
+            child->decReferenceCount();
+            if (this->isUnreferenced(child))
+              worklist.push_back(child);
+          }
+
+          /* Delete the node */
+          delete node;
+        }
+      }
+
+      roots.clear();
+    }
+
+
     void AstGarbageCollector::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
-      std::vector<triton::ast::AbstractNode*>::const_iterator it;
-      uniqueNodes.insert(root);
-      for (it = root->getChilds().begin(); it != root->getChilds().end(); it++)
-        this->extractUniqueAstNodes(uniqueNodes, *it);
+      triton::ast::preOrderWalk(root, [&uniqueNodes](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+        /* A subtree shared by several nodes is walked once */
+        if (!uniqueNodes.insert(node).second)
+          return false;
+        for (triton::ast::AbstractNode* child : node->getChilds())
+          successors.push_back(child);
+        return true;
+      });
     }
 
 
@@ -99,13 +208,28 @@ namespace triton {
       /* Check if the AST_DICTIONARIES is enabled. */
       if (this->modes->isModeEnabled(triton::modes::AST_DICTIONARIES)) {
         triton::ast::AbstractNode* ret = this->browseAstDictionaries(node);
-        if (ret != nullptr)
+        if (ret != nullptr) {
+          /* The duplicate is already linked to its childs (the ones of the canonical node), unlink it before it is deleted */
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+            if (triton::api.isSymbolicExpressionIdExists(id))
+              triton::api.getAstFromId(id)->removeParent(node);
+          }
+
+          for (triton::ast::AbstractNode* child : node->getChilds()) {
+            child->removeParent(node);
+            child->decReferenceCount();
+          }
+
+          delete node;
           return ret;
+        }
       }
-      else {
-        /* Record the node */
-        this->allocatedNodes.insert(node);
-      }
+
+      /* Record the node, a canonical node is owned as any other */
+      node->setRecordIndex(static_cast<triton::uint32>(this->allocatedNodes.size()));
+      this->allocatedNodes.push_back(node);
+
       return node;
     }
 
@@ -115,11 +239,30 @@ namespace triton {
     }
 
 
-    const std::set<triton::ast::AbstractNode*>& AstGarbageCollector::getAllocatedAstNodes(void) const {
+    const std::vector<triton::ast::AbstractNode*>& AstGarbageCollector::getAllocatedAstNodes(void) const {
       return this->allocatedNodes;
     }
 
 
+    std::map<std::string, triton::usize> AstGarbageCollector::getAstMemoryStats(void) const {
+      const triton::ast::AstAllocator& allocator = triton::ast::AstAllocator::getInstance();
+      std::map<std::string, triton::usize> stats;
+
+      /* Every block which is not out of line storage is a node */
+      stats["nodes"]              = allocator.getLiveBlocks() - allocator.getOutOfLineBlocks();
+      stats["nodes_memory"]       = allocator.getLiveMemory() - allocator.getOutOfLineMemory();
+      stats["out_of_line_blocks"] = allocator.getOutOfLineBlocks();
+      stats["out_of_line_memory"] = allocator.getOutOfLineMemory();
+      stats["reserved_memory"]    = allocator.getReservedMemory();
+      stats["bytes_per_node"]     = 0;
+
+      if (stats["nodes"] != 0)
+        stats["bytes_per_node"] = allocator.getLiveMemory() / stats["nodes"];
+
+      return stats;
+    }
+
+
     const std::map<std::string, triton::ast::AbstractNode*>& AstGarbageCollector::getAstVariableNodes(void) const {
       return this->variableNodes;
     }
@@ -132,13 +275,8 @@ namespace triton {
     }
 
 
-    void AstGarbageCollector::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
-      /* Remove unused nodes before the assignation */
-      for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
-        if (nodes.find(*it) == nodes.end())
-          delete *it;
-      }
-      this->allocatedNodes = nodes;
+    void AstGarbageCollector::setAllocatedAstNodes(const std::vector<triton::ast::AbstractNode*>& nodes) {
+      this->assignAllocatedAstNodes(nodes);
     }
 
 
@@ -0,0 +1,784 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include <triton/astTape.hpp>
+#include <triton/astWalker.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The number of evaluations run side by side by evaluateBatch() */
+    static const triton::uint32 BATCH_LANES = 64;
+
+
+    /* Returns true if the node is computed from its childs */
+    static bool isOperation(triton::ast::kind_e kind) {
+      switch (kind) {
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVASHR_NODE:
+        case BVLSHR_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNEG_NODE:
+        case BVNOR_NODE:
+        case BVNOT_NODE:
+        case BVOR_NODE:
+        case BVROL_NODE:
+        case BVROR_NODE:
+        case BVSDIV_NODE:
+        case BVSGE_NODE:
+        case BVSGT_NODE:
+        case BVSHL_NODE:
+        case BVSLE_NODE:
+        case BVSLT_NODE:
+        case BVSMOD_NODE:
+        case BVSREM_NODE:
+        case BVSUB_NODE:
+        case BVUDIV_NODE:
+        case BVUGE_NODE:
+        case BVUGT_NODE:
+        case BVULE_NODE:
+        case BVULT_NODE:
+        case BVUREM_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case CONCAT_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case EXTRACT_NODE:
+        case ITE_NODE:
+        case LAND_NODE:
+        case LNOT_NODE:
+        case LOR_NODE:
+        case SX_NODE:
+        case ZX_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    static inline triton::uint64 nativeMask(triton::uint32 size) {
+      if (size >= 64)
+        return 0xffffffffffffffffULL;
+      return ((1ULL << size) - 1);
+    }
+
+
+    static inline triton::uint512 wideMask(triton::uint32 size) {
+      triton::uint512 mask = -1;
+      mask = mask >> (512 - size);
+      return mask;
+    }
+
+
+    static inline bool nativeIsSigned(triton::uint64 value, triton::uint32 size) {
+      return size != 0 && ((value >> (size-1)) & 1);
+    }
+
+
+    static inline triton::sint64 nativeSignExtend(triton::uint64 value, triton::uint32 size) {
+      if (nativeIsSigned(value, size))
+        value |= ~nativeMask(size);
+      return static_cast<triton::sint64>(value);
+    }
+
+
+    /* Branch-free version of nativeSignExtend(), the lanes are vectorized */
+    static inline triton::uint64 laneSignExtend(triton::uint64 value, triton::uint32 size) {
+      return value | ((0 - ((value >> (size-1)) & 1)) & ~nativeMask(size));
+    }
+
+
+    static inline triton::sint512 wideSignExtend(const triton::uint512& value, triton::uint32 size) {
+      triton::sint512 signedValue = 0;
+
+      if ((value >> (size-1)) & 1) {
+        signedValue = -1;
+        signedValue = ((signedValue << size) | value);
+      }
+      else {
+        signedValue = value;
+      }
+
+      return signedValue;
+    }
+
+
+    AstTape::AstTape(triton::ast::AbstractNode* node, triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AstTape::AstTape(): node cannot be null.");
+
+      if (symbolicEngine == nullptr)
+        throw triton::exceptions::Ast("AstTape::AstTape(): The symbolicEngine API cannot be null.");
+
+      this->compile(node, symbolicEngine);
+    }
+
+
+    void AstTape::compile(triton::ast::AbstractNode* root, triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+      std::map<std::string, std::pair<Operand, bool>> bindings;
+      std::unordered_map<triton::usize, triton::uint32> inputsIndex;
+
+      this->output = this->compileTree(root, symbolicEngine, bindings, inputsIndex).first;
+    }
+
+
+    std::pair<AstTape::Operand, bool> AstTape::compileTree(triton::ast::AbstractNode* root,
+                                                           triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                                           const std::map<std::string, std::pair<Operand, bool>>& bindings,
+                                                           std::unordered_map<triton::usize, triton::uint32>& inputsIndex) {
+      /* The register of each compiled node, and true if it depends on a symbolic variable */
+      std::unordered_map<triton::ast::AbstractNode*, std::pair<Operand, bool>> compiled;
+
+      /* Appends an instruction, or runs it right away if all its operands are constants */
+      auto emit = [this](Instruction& inst, triton::uint32 size, triton::uint32 count, const bool* symbolics) {
+        bool symbolic = false;
+
+        inst.destination = this->newRegister(size);
+        inst.native      = (size <= 64);
+        for (triton::uint32 index = 0; index < 3; index++) {
+          if (index >= count) {
+            inst.operands[index] = inst.destination;
+            continue;
+          }
+          symbolic    |= symbolics[index];
+          inst.native &= (inst.operands[index].size <= 64);
+        }
+
+        /* The signed divisions are only computed with wide values */
+        if (inst.kind == BVSDIV_NODE || inst.kind == BVSMOD_NODE || inst.kind == BVSREM_NODE)
+          inst.native = false;
+
+        if (symbolic)
+          this->instructions.push_back(inst);
+        else
+          this->execute(inst);
+
+        return std::make_pair(inst.destination, symbolic);
+      };
+
+      triton::ast::postOrderWalk(root,
+        [&compiled, symbolicEngine](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+          if (compiled.find(node) != compiled.end())
+            return false;
+
+          switch (node->getKind()) {
+            case REFERENCE_NODE: {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+              successors.push_back(symbolicEngine->getSymbolicExpressionFromId(id)->getAst());
+              break;
+            }
+
+            /* The body is compiled with the binding, by another walk */
+            case LET_NODE:
+              successors.push_back(node->getChilds()[1]);
+              break;
+
+            case ASSERT_NODE:
+              successors.push_back(node->getChilds()[0]);
+              break;
+
+            default:
+              if (isOperation(node->getKind())) {
+                for (triton::ast::AbstractNode* child : node->getChilds())
+                  successors.push_back(child);
+              }
+              break;
+          }
+
+          return true;
+        },
+        [this, &compiled, &bindings, &inputsIndex, &emit, symbolicEngine](triton::ast::AbstractNode* node) {
+          const triton::ast::ChildVector& childs = node->getChilds();
+          Instruction inst = {};
+          bool symbolics[3] = {false, false, false};
+          triton::uint32 first = 0;
+          triton::uint32 count = 0;
+
+          switch (node->getKind()) {
+            /* A reference is its sub-tree, an assert is the value of its constraint */
+            case REFERENCE_NODE: {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+              compiled[node] = compiled[symbolicEngine->getSymbolicExpressionFromId(id)->getAst()];
+              return;
+            }
+
+            case ASSERT_NODE:
+              if (childs.size() != 1)
+                throw triton::exceptions::Ast("AstTape::compile(): An assert must have a single constraint.");
+              compiled[node] = compiled[childs[0]];
+              return;
+
+            /* A let is its body, where its name is bound to its value */
+            case LET_NODE: {
+              std::map<std::string, std::pair<Operand, bool>> scope = bindings;
+              scope[reinterpret_cast<triton::ast::StringNode*>(childs[0])->getValue()] = compiled[childs[1]];
+              compiled[node] = this->compileTree(childs[2], symbolicEngine, scope, inputsIndex);
+              return;
+            }
+
+            /* A name is the value bound by the closest let */
+            case STRING_NODE: {
+              auto it = bindings.find(reinterpret_cast<triton::ast::StringNode*>(node)->getValue());
+              if (it == bindings.end())
+                throw triton::exceptions::Ast("AstTape::compile(): The name is not bound by a let.");
+              compiled[node] = it->second;
+              return;
+            }
+
+            /* A symbolic variable is an input, given to evaluate() */
+            case VARIABLE_NODE: {
+              triton::engines::symbolic::SymbolicVariable* symVar = symbolicEngine->getSymbolicVariableFromName(reinterpret_cast<triton::ast::VariableNode*>(node)->getValue());
+              if (symVar == nullptr)
+                throw triton::exceptions::Ast("AstTape::compile(): Variable not found.");
+
+              auto it = inputsIndex.find(symVar->getId());
+              if (it == inputsIndex.end()) {
+                it = inputsIndex.insert(std::make_pair(symVar->getId(), static_cast<triton::uint32>(this->inputs.size()))).first;
+                this->variables.push_back(symVar->getId());
+                this->inputs.push_back(this->newRegister(symVar->getSize()));
+              }
+
+              compiled[node] = std::make_pair(this->inputs[it->second], true);
+              return;
+            }
+
+            /* (concat a b c) is compiled as (concat (concat a b) c) */
+            case CONCAT_NODE: {
+              std::pair<Operand, bool> value = compiled[childs[0]];
+              for (triton::uint32 index = 1; index < childs.size(); index++) {
+                std::pair<Operand, bool> next = compiled[childs[index]];
+                inst.kind        = CONCAT_NODE;
+                inst.operands[0] = value.first;
+                inst.operands[1] = next.first;
+                symbolics[0]     = value.second;
+                symbolics[1]     = next.second;
+                value = emit(inst, value.first.size + next.first.size, 2, symbolics);
+              }
+              compiled[node] = value;
+              return;
+            }
+
+            /* The decimal childs of these nodes are immediates */
+            case EXTRACT_NODE:
+              inst.immediate = reinterpret_cast<triton::ast::DecimalNode*>(childs[1])->getValue().convert_to<triton::uint32>();
+              first = 2;
+              count = 1;
+              break;
+
+            case BVROL_NODE:
+            case BVROR_NODE:
+            case SX_NODE:
+            case ZX_NODE:
+              inst.immediate = reinterpret_cast<triton::ast::DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>();
+              first = 1;
+              count = 1;
+              break;
+
+            case BVNEG_NODE:
+            case BVNOT_NODE:
+            case LNOT_NODE:
+              count = 1;
+              break;
+
+            case ITE_NODE:
+              count = 3;
+              break;
+
+            /* The decimal childs are read as immediates by their parent */
+            case DECIMAL_NODE:
+              return;
+
+            /* A bit-vector is a constant */
+            case BV_NODE: {
+              Operand constant = this->newRegister(node->getBitvectorSize());
+              this->setWide(constant, node->evaluate());
+              compiled[node] = std::make_pair(constant, false);
+              return;
+            }
+
+            default:
+              /* The commands and declarations have no value */
+              if (!isOperation(node->getKind()))
+                throw triton::exceptions::Ast("AstTape::compile(): Unsupported node kind.");
+              count = 2;
+              break;
+          }
+
+          for (triton::uint32 index = 0; index < count; index++) {
+            const std::pair<Operand, bool>& operand = compiled[childs[first + index]];
+            inst.operands[index] = operand.first;
+            symbolics[index]     = operand.second;
+          }
+
+          /* The size comes from the operands, a name bound by a let has no size in the AST */
+          triton::uint32 size = inst.operands[0].size;
+          switch (node->getKind()) {
+            case BVROL_NODE:
+            case BVROR_NODE:
+              inst.immediate %= size;
+              break;
+
+            case SX_NODE:
+            case ZX_NODE:
+              size += inst.immediate;
+              break;
+
+            case ITE_NODE:
+              size = inst.operands[1].size;
+              break;
+
+            case BVSGE_NODE:
+            case BVSGT_NODE:
+            case BVSLE_NODE:
+            case BVSLT_NODE:
+            case BVUGE_NODE:
+            case BVUGT_NODE:
+            case BVULE_NODE:
+            case BVULT_NODE:
+            case DISTINCT_NODE:
+            case EQUAL_NODE:
+            case EXTRACT_NODE:
+            case LAND_NODE:
+            case LNOT_NODE:
+            case LOR_NODE:
+              size = node->getBitvectorSize();
+              break;
+
+            default:
+              break;
+          }
+
+          inst.kind = node->getKind();
+          compiled[node] = emit(inst, size, count, symbolics);
+        });
+
+      return compiled[root];
+    }
+
+
+    AstTape::Operand AstTape::newRegister(triton::uint32 size) {
+      Operand op;
+
+      op.size = size;
+      if (size <= 64) {
+        op.index = static_cast<triton::uint32>(this->natives.size());
+        this->natives.push_back(0);
+      }
+      else {
+        op.index = static_cast<triton::uint32>(this->wides.size());
+        this->wides.push_back(0);
+      }
+
+      return op;
+    }
+
+
+    triton::uint64 AstTape::getNative(const Operand& op) const {
+      if (op.size <= 64)
+        return this->natives[op.index];
+      return (this->wides[op.index] & 0xffffffffffffffffULL).convert_to<triton::uint64>();
+    }
+
+
+    triton::uint512 AstTape::getWide(const Operand& op) const {
+      if (op.size <= 64)
+        return this->natives[op.index];
+      return this->wides[op.index];
+    }
+
+
+    void AstTape::setNative(const Operand& op, triton::uint64 value) {
+      if (op.size <= 64)
+        this->natives[op.index] = value;
+      else
+        this->wides[op.index] = value;
+    }
+
+
+    void AstTape::setWide(const Operand& op, const triton::uint512& value) {
+      if (op.size <= 64)
+        this->natives[op.index] = (value & 0xffffffffffffffffULL).convert_to<triton::uint64>();
+      else
+        this->wides[op.index] = value;
+    }
+
+
+    void AstTape::execute(const Instruction& inst) {
+      if (inst.native)
+        this->executeNative(inst);
+      else
+        this->executeWide(inst);
+    }
+
+
+    void AstTape::executeNative(const Instruction& inst) {
+      triton::uint32 size   = inst.destination.size;
+      triton::uint32 opSize = inst.operands[0].size;
+      triton::uint64 mask   = nativeMask(size);
+      triton::uint64 op1    = this->natives[inst.operands[0].index];
+      triton::uint64 op2    = this->natives[inst.operands[1].index];
+      triton::uint64 op3    = this->natives[inst.operands[2].index];
+      triton::uint64 value  = 0;
+
+      switch (inst.kind) {
+        case BVADD_NODE:  value = (op1 + op2) & mask; break;
+        case BVAND_NODE:  value = op1 & op2; break;
+        case BVMUL_NODE:  value = (op1 * op2) & mask; break;
+        case BVNAND_NODE: value = ~(op1 & op2) & mask; break;
+        case BVNEG_NODE:  value = (0 - op1) & mask; break;
+        case BVNOR_NODE:  value = ~(op1 | op2) & mask; break;
+        case BVNOT_NODE:  value = ~op1 & mask; break;
+        case BVOR_NODE:   value = op1 | op2; break;
+        case BVSUB_NODE:  value = (op1 - op2) & mask; break;
+        case BVXNOR_NODE: value = ~(op1 ^ op2) & mask; break;
+        case BVXOR_NODE:  value = op1 ^ op2; break;
+        case BVSHL_NODE:  value = (op2 >= size) ? 0 : (op1 << op2) & mask; break;
+        case BVLSHR_NODE: value = (op2 >= size) ? 0 : op1 >> op2; break;
+        case BVUDIV_NODE: value = (op2 == 0) ? mask : op1 / op2; break;
+        case BVUREM_NODE: value = (op2 == 0) ? op1 : op1 % op2; break;
+        case BVUGE_NODE:  value = op1 >= op2; break;
+        case BVUGT_NODE:  value = op1 > op2; break;
+        case BVULE_NODE:  value = op1 <= op2; break;
+        case BVULT_NODE:  value = op1 < op2; break;
+        case BVSGE_NODE:  value = nativeSignExtend(op1, opSize) >= nativeSignExtend(op2, opSize); break;
+        case BVSGT_NODE:  value = nativeSignExtend(op1, opSize) > nativeSignExtend(op2, opSize); break;
+        case BVSLE_NODE:  value = nativeSignExtend(op1, opSize) <= nativeSignExtend(op2, opSize); break;
+        case BVSLT_NODE:  value = nativeSignExtend(op1, opSize) < nativeSignExtend(op2, opSize); break;
+        case DISTINCT_NODE: value = op1 != op2; break;
+        case EQUAL_NODE:  value = op1 == op2; break;
+        case LAND_NODE:   value = op1 && op2; break;
+        case LNOT_NODE:   value = !op1; break;
+        case LOR_NODE:    value = op1 || op2; break;
+        case ITE_NODE:    value = (op1 != 0) ? op2 : op3; break;
+        case EXTRACT_NODE: value = (op1 >> inst.immediate) & mask; break;
+        case ZX_NODE:     value = op1 & mask; break;
+        case SX_NODE:     value = (nativeIsSigned(op1, opSize) ? (op1 | ~nativeMask(opSize)) : op1) & mask; break;
+
+        case BVASHR_NODE:
+          if (op2 >= size)
+            value = nativeIsSigned(op1, opSize) ? mask : 0;
+          else if (op2 == 0 || !nativeIsSigned(op1, opSize))
+            value = op1 >> op2;
+          else
+            value = ((op1 >> op2) | (mask << (size - op2))) & mask;
+          break;
+
+        case BVROL_NODE:
+          value = (inst.immediate == 0) ? op1 : ((op1 << inst.immediate) | (op1 >> (size - inst.immediate))) & mask;
+          break;
+
+        case BVROR_NODE:
+          value = (inst.immediate == 0) ? op1 : ((op1 >> inst.immediate) | (op1 << (size - inst.immediate))) & mask;
+          break;
+
+        case CONCAT_NODE: {
+          triton::uint32 shift = inst.operands[1].size;
+          value = ((shift < 64) ? (op1 << shift) : 0) | op2;
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Ast("AstTape::executeNative(): Invalid kind of node.");
+      }
+
+      this->setNative(inst.destination, value);
+    }
+
+
+    void AstTape::executeWide(const Instruction& inst) {
+      triton::uint32 size    = inst.destination.size;
+      triton::uint32 opSize  = inst.operands[0].size;
+      triton::uint512 mask   = wideMask(size);
+      triton::uint512 op1    = this->getWide(inst.operands[0]);
+      triton::uint512 op2    = this->getWide(inst.operands[1]);
+      triton::uint512 op3    = this->getWide(inst.operands[2]);
+      triton::uint512 value  = 0;
+
+      switch (inst.kind) {
+        case BVADD_NODE:  value = (op1 + op2) & mask; break;
+        case BVAND_NODE:  value = op1 & op2; break;
+        case BVMUL_NODE:  value = (op1 * op2) & mask; break;
+        case BVNAND_NODE: value = ~(op1 & op2) & mask; break;
+        case BVNEG_NODE:  value = (-(op1.convert_to<triton::sint512>())).convert_to<triton::uint512>() & mask; break;
+        case BVNOR_NODE:  value = ~(op1 | op2) & mask; break;
+        case BVNOT_NODE:  value = ~op1 & mask; break;
+        case BVOR_NODE:   value = op1 | op2; break;
+        case BVSUB_NODE:  value = (op1 - op2) & mask; break;
+        case BVXNOR_NODE: value = ~(op1 ^ op2) & mask; break;
+        case BVXOR_NODE:  value = op1 ^ op2; break;
+        case BVSHL_NODE:  value = (op2 >= size) ? triton::uint512(0) : (op1 << op2.convert_to<triton::uint32>()) & mask; break;
+        case BVLSHR_NODE: value = (op2 >= size) ? triton::uint512(0) : op1 >> op2.convert_to<triton::uint32>(); break;
+        case BVUDIV_NODE: value = (op2 == 0) ? mask : op1 / op2; break;
+        case BVUREM_NODE: value = (op2 == 0) ? op1 : op1 % op2; break;
+        case BVUGE_NODE:  value = op1 >= op2; break;
+        case BVUGT_NODE:  value = op1 > op2; break;
+        case BVULE_NODE:  value = op1 <= op2; break;
+        case BVULT_NODE:  value = op1 < op2; break;
+        case BVSGE_NODE:  value = wideSignExtend(op1, opSize) >= wideSignExtend(op2, opSize); break;
+        case BVSGT_NODE:  value = wideSignExtend(op1, opSize) > wideSignExtend(op2, opSize); break;
+        case BVSLE_NODE:  value = wideSignExtend(op1, opSize) <= wideSignExtend(op2, opSize); break;
+        case BVSLT_NODE:  value = wideSignExtend(op1, opSize) < wideSignExtend(op2, opSize); break;
+        case DISTINCT_NODE: value = op1 != op2; break;
+        case EQUAL_NODE:  value = op1 == op2; break;
+        case LAND_NODE:   value = (op1 != 0 && op2 != 0); break;
+        case LNOT_NODE:   value = (op1 == 0); break;
+        case LOR_NODE:    value = (op1 != 0 || op2 != 0); break;
+        case ITE_NODE:    value = (op1 != 0) ? op2 : op3; break;
+        case EXTRACT_NODE: value = (op1 >> inst.immediate) & mask; break;
+        case ZX_NODE:     value = op1 & mask; break;
+        case SX_NODE:     value = (((op1 >> (opSize-1)) == 0) ? op1 : (op1 | ~wideMask(opSize))) & mask; break;
+        case CONCAT_NODE: value = (op1 << inst.operands[1].size) | op2; break;
+
+        /* The bits shifted in are copies of the sign bit */
+        case BVASHR_NODE: {
+          bool sign = ((op1 >> (opSize-1)) & 1) != 0;
+          if (op2 >= size)
+            value = sign ? mask : triton::uint512(0);
+          else {
+            triton::uint32 shift = op2.convert_to<triton::uint32>();
+            value = ((op1 & mask) >> shift) | (sign ? (mask & ~(mask >> shift)) : triton::uint512(0));
+          }
+          break;
+        }
+
+        case BVROL_NODE:
+          value = ((op1 << inst.immediate) | (op1 >> (size - inst.immediate))) & mask;
+          break;
+
+        case BVROR_NODE:
+          value = ((op1 >> inst.immediate) | (op1 << (size - inst.immediate))) & mask;
+          break;
+
+        case BVSDIV_NODE: {
+          triton::sint512 op1Signed = wideSignExtend(op1, opSize);
+          triton::sint512 op2Signed = wideSignExtend(op2, opSize);
+          if (op2Signed == 0)
+            value = triton::uint512(op1Signed < 0 ? 1 : -1) & mask;
+          else
+            value = (op1Signed / op2Signed).convert_to<triton::uint512>() & mask;
+          break;
+        }
+
+        case BVSMOD_NODE: {
+          triton::sint512 op1Signed = wideSignExtend(op1, opSize);
+          triton::sint512 op2Signed = wideSignExtend(op2, opSize);
+          if (op2Signed == 0)
+            value = op1;
+          else
+            value = (((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & mask;
+          break;
+        }
+
+        case BVSREM_NODE: {
+          triton::sint512 op1Signed = wideSignExtend(op1, opSize);
+          triton::sint512 op2Signed = wideSignExtend(op2, opSize);
+          if (op2Signed == 0)
+            value = op1;
+          else
+            value = (op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & mask;
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Ast("AstTape::executeWide(): Invalid kind of node.");
+      }
+
+      this->setWide(inst.destination, value);
+    }
+
+
+    void AstTape::executeLanes(const Instruction& inst) {
+      triton::uint32 size       = inst.destination.size;
+      triton::uint32 opSize     = inst.operands[0].size;
+      triton::uint64 mask       = nativeMask(size);
+      triton::uint64 sign       = 1ULL << (opSize - 1);
+      triton::uint64* dst       = &this->lanes[inst.destination.index * BATCH_LANES];
+      const triton::uint64* op1 = &this->lanes[inst.operands[0].index * BATCH_LANES];
+      const triton::uint64* op2 = &this->lanes[inst.operands[1].index * BATCH_LANES];
+      const triton::uint64* op3 = &this->lanes[inst.operands[2].index * BATCH_LANES];
+      triton::uint32 i          = 0;
+
+      /* Same semantics as executeNative(), written without branches inside the loops */
+      switch (inst.kind) {
+        case BVADD_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] + op2[i]) & mask; break;
+        case BVAND_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] & op2[i]; break;
+        case BVMUL_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] * op2[i]) & mask; break;
+        case BVNAND_NODE: for (i = 0; i < BATCH_LANES; i++) dst[i] = ~(op1[i] & op2[i]) & mask; break;
+        case BVNEG_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = (0 - op1[i]) & mask; break;
+        case BVNOR_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = ~(op1[i] | op2[i]) & mask; break;
+        case BVNOT_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = ~op1[i] & mask; break;
+        case BVOR_NODE:   for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] | op2[i]; break;
+        case BVSUB_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] - op2[i]) & mask; break;
+        case BVXNOR_NODE: for (i = 0; i < BATCH_LANES; i++) dst[i] = ~(op1[i] ^ op2[i]) & mask; break;
+        case BVXOR_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] ^ op2[i]; break;
+        case BVSHL_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = (op2[i] >= size) ? 0 : (op1[i] << (op2[i] & 63)) & mask; break;
+        case BVLSHR_NODE: for (i = 0; i < BATCH_LANES; i++) dst[i] = (op2[i] >= size) ? 0 : op1[i] >> (op2[i] & 63); break;
+        case BVUDIV_NODE: for (i = 0; i < BATCH_LANES; i++) dst[i] = (op2[i] == 0) ? mask : op1[i] / op2[i]; break;
+        case BVUREM_NODE: for (i = 0; i < BATCH_LANES; i++) dst[i] = (op2[i] == 0) ? op1[i] : op1[i] % op2[i]; break;
+        case BVUGE_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] >= op2[i]; break;
+        case BVUGT_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] > op2[i]; break;
+        case BVULE_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] <= op2[i]; break;
+        case BVULT_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] < op2[i]; break;
+        /* Flipping the sign bits turns a signed comparison into an unsigned one */
+        case BVSGE_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] ^ sign) >= (op2[i] ^ sign); break;
+        case BVSGT_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] ^ sign) > (op2[i] ^ sign); break;
+        case BVSLE_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] ^ sign) <= (op2[i] ^ sign); break;
+        case BVSLT_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] ^ sign) < (op2[i] ^ sign); break;
+        case DISTINCT_NODE: for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] != op2[i]; break;
+        case EQUAL_NODE:  for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] == op2[i]; break;
+        case LAND_NODE:   for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] != 0) & (op2[i] != 0); break;
+        case LNOT_NODE:   for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] == 0; break;
+        case LOR_NODE:    for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] != 0) | (op2[i] != 0); break;
+        case ITE_NODE:    for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] != 0) ? op2[i] : op3[i]; break;
+        case EXTRACT_NODE: for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] >> inst.immediate) & mask; break;
+        case ZX_NODE:     for (i = 0; i < BATCH_LANES; i++) dst[i] = op1[i] & mask; break;
+        case SX_NODE:     for (i = 0; i < BATCH_LANES; i++) dst[i] = laneSignExtend(op1[i], opSize) & mask; break;
+
+        /* Shifting the sign extended value by 63 or less copies the sign bit */
+        case BVASHR_NODE:
+          for (i = 0; i < BATCH_LANES; i++)
+            dst[i] = static_cast<triton::uint64>(static_cast<triton::sint64>(laneSignExtend(op1[i], opSize)) >> std::min<triton::uint64>(op2[i], 63)) & mask;
+          break;
+
+        case BVROL_NODE:
+          if (inst.immediate == 0)
+            std::copy(op1, op1 + BATCH_LANES, dst);
+          else
+            for (i = 0; i < BATCH_LANES; i++) dst[i] = ((op1[i] << inst.immediate) | (op1[i] >> (size - inst.immediate))) & mask;
+          break;
+
+        case BVROR_NODE:
+          if (inst.immediate == 0)
+            std::copy(op1, op1 + BATCH_LANES, dst);
+          else
+            for (i = 0; i < BATCH_LANES; i++) dst[i] = ((op1[i] >> inst.immediate) | (op1[i] << (size - inst.immediate))) & mask;
+          break;
+
+        case CONCAT_NODE: {
+          triton::uint32 shift = inst.operands[1].size;
+          if (shift < 64)
+            for (i = 0; i < BATCH_LANES; i++) dst[i] = (op1[i] << shift) | op2[i];
+          else
+            std::copy(op2, op2 + BATCH_LANES, dst);
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Ast("AstTape::executeLanes(): Invalid kind of node.");
+      }
+    }
+
+
+    bool AstTape::isNative(void) const {
+      if (this->output.size > 64)
+        return false;
+
+      for (const Operand& input : this->inputs) {
+        if (input.size > 64)
+          return false;
+      }
+
+      for (const Instruction& inst : this->instructions) {
+        if (!inst.native)
+          return false;
+      }
+
+      return true;
+    }
+
+
+    const std::vector<triton::usize>& AstTape::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    triton::usize AstTape::getNumberOfInstructions(void) const {
+      return this->instructions.size();
+    }
+
+
+    triton::uint32 AstTape::getBitvectorSize(void) const {
+      return this->output.size;
+    }
+
+
+    triton::uint512 AstTape::evaluate(const std::vector<triton::uint512>& values) {
+      if (values.size() != this->inputs.size())
+        throw triton::exceptions::Ast("AstTape::evaluate(): Expects one value per symbolic variable.");
+
+      for (triton::uint32 index = 0; index < this->inputs.size(); index++) {
+        const Operand& input = this->inputs[index];
+        if (input.size <= 64)
+          this->natives[input.index] = (values[index] & nativeMask(input.size)).convert_to<triton::uint64>();
+        else
+          this->wides[input.index] = values[index] & wideMask(input.size);
+      }
+
+      for (const Instruction& inst : this->instructions)
+        this->execute(inst);
+
+      return this->getWide(this->output);
+    }
+
+
+    std::vector<triton::uint512> AstTape::evaluateBatch(const std::vector<std::vector<triton::uint512>>& values) {
+      std::vector<triton::uint512> results;
+
+      for (const std::vector<triton::uint512>& item : values) {
+        if (item.size() != this->inputs.size())
+          throw triton::exceptions::Ast("AstTape::evaluateBatch(): Expects one value per symbolic variable.");
+      }
+
+      results.reserve(values.size());
+
+      /* The wide registers are not vectorized, each evaluation is run on its own */
+      if (!this->isNative()) {
+        for (const std::vector<triton::uint512>& item : values)
+          results.push_back(this->evaluate(item));
+        return results;
+      }
+
+      /* Every lane starts with the constants. Only the inputs and the destinations are written after */
+      this->lanes.resize(this->natives.size() * BATCH_LANES);
+      for (triton::uint32 reg = 0; reg < this->natives.size(); reg++)
+        std::fill_n(&this->lanes[reg * BATCH_LANES], BATCH_LANES, this->natives[reg]);
+
+      for (triton::usize base = 0; base < values.size(); base += BATCH_LANES) {
+        /* The lanes after the last evaluation keep old values, their results are dropped */
+        triton::usize count = std::min<triton::usize>(values.size() - base, BATCH_LANES);
+
+        for (triton::uint32 index = 0; index < this->inputs.size(); index++) {
+          const Operand& input = this->inputs[index];
+          triton::uint64 mask  = nativeMask(input.size);
+          for (triton::usize lane = 0; lane < count; lane++)
+            this->lanes[input.index * BATCH_LANES + lane] = (values[base + lane][index] & mask).convert_to<triton::uint64>();
+        }
+
+        for (const Instruction& inst : this->instructions)
+          this->executeLanes(inst);
+
+        for (triton::usize lane = 0; lane < count; lane++)
+          results.push_back(this->lanes[this->output.index * BATCH_LANES + lane]);
+      }
+
+      return results;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -6,6 +6,7 @@
 */
 
 #include <triton/astPythonRepresentation.hpp>
+#include <triton/astWalker.hpp>
 #include <triton/exceptions.hpp>
 
 
@@ -14,438 +15,176 @@ namespace triton {
   namespace ast {
     namespace representations {
 
-      AstPythonRepresentation::AstPythonRepresentation() {
+      /* Closes an operation which may overflow with the mask of its node */
+      static void printMask(std::ostream& stream, triton::ast::AbstractNode* node) {
+        stream << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
       }
 
 
-      AstPythonRepresentation::~AstPythonRepresentation() {
+      /* Prints `open` child `close`, part by part */
+      static triton::ast::AbstractNode* printUnary(std::ostream& stream, triton::usize part, const char* open, triton::ast::AbstractNode* child, const char* close) {
+        if (part == 0) {
+          stream << open;
+          return child;
+        }
+        stream << close;
+        return nullptr;
       }
 
 
-      /* Representation dispatcher from an abstract node */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
-        switch (node->getKind()) {
-          case ASSERT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::AssertNode*>(node)); break;
-          case BVADD_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvaddNode*>(node)); break;
-          case BVAND_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvandNode*>(node)); break;
-          case BVASHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvashrNode*>(node)); break;
-          case BVDECL_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvdeclNode*>(node)); break;
-          case BVLSHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvlshrNode*>(node)); break;
-          case BVMUL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvmulNode*>(node)); break;
-          case BVNAND_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvnandNode*>(node)); break;
-          case BVNEG_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnegNode*>(node)); break;
-          case BVNOR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnorNode*>(node)); break;
-          case BVNOT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnotNode*>(node)); break;
-          case BVOR_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvorNode*>(node)); break;
-          case BVROL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrolNode*>(node)); break;
-          case BVROR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrorNode*>(node)); break;
-          case BVSDIV_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsdivNode*>(node)); break;
-          case BVSGE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsgeNode*>(node)); break;
-          case BVSGT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsgtNode*>(node)); break;
-          case BVSHL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvshlNode*>(node)); break;
-          case BVSLE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsleNode*>(node)); break;
-          case BVSLT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsltNode*>(node)); break;
-          case BVSMOD_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsmodNode*>(node)); break;
-          case BVSREM_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsremNode*>(node)); break;
-          case BVSUB_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsubNode*>(node)); break;
-          case BVUDIV_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvudivNode*>(node)); break;
-          case BVUGE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvugeNode*>(node)); break;
-          case BVUGT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvugtNode*>(node)); break;
-          case BVULE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvuleNode*>(node)); break;
-          case BVULT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvultNode*>(node)); break;
-          case BVUREM_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvuremNode*>(node)); break;
-          case BVXNOR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvxnorNode*>(node)); break;
-          case BVXOR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvxorNode*>(node)); break;
-          case BV_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::BvNode*>(node)); break;
-          case COMPOUND_NODE:             return this->print(stream, reinterpret_cast<triton::ast::CompoundNode*>(node)); break;
-          case CONCAT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::ConcatNode*>(node)); break;
-          case DECIMAL_NODE:              return this->print(stream, reinterpret_cast<triton::ast::DecimalNode*>(node)); break;
-          case DECLARE_FUNCTION_NODE:     return this->print(stream, reinterpret_cast<triton::ast::DeclareFunctionNode*>(node)); break;
-          case DISTINCT_NODE:             return this->print(stream, reinterpret_cast<triton::ast::DistinctNode*>(node)); break;
-          case EQUAL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::EqualNode*>(node)); break;
-          case EXTRACT_NODE:              return this->print(stream, reinterpret_cast<triton::ast::ExtractNode*>(node)); break;
-          case ITE_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::IteNode*>(node)); break;
-          case LAND_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LandNode*>(node)); break;
-          case LET_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LetNode*>(node)); break;
-          case LNOT_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LnotNode*>(node)); break;
-          case LOR_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LorNode*>(node)); break;
-          case REFERENCE_NODE:            return this->print(stream, reinterpret_cast<triton::ast::ReferenceNode*>(node)); break;
-          case STRING_NODE:               return this->print(stream, reinterpret_cast<triton::ast::StringNode*>(node)); break;
-          case SX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::SxNode*>(node)); break;
-          case VARIABLE_NODE:             return this->print(stream, reinterpret_cast<triton::ast::VariableNode*>(node)); break;
-          case ZX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::ZxNode*>(node)); break;
+      /* Prints `open` child0 `op` child1, closed with the mask of the node if `masked`, part by part */
+      static triton::ast::AbstractNode* printBinary(std::ostream& stream, triton::ast::AbstractNode* node, triton::usize part, const char* open, const char* op, bool masked) {
+        switch (part) {
+          case 0:
+            stream << open;
+            return node->getChilds()[0];
+          case 1:
+            stream << op;
+            return node->getChilds()[1];
           default:
-            throw triton::exceptions::AstRepresentation("AstPythonRepresentation::print(AbstractNode): Invalid kind node.");
+            if (masked)
+              printMask(stream, node);
+            else
+              stream << ")";
+            return nullptr;
         }
-        return stream;
-      }
-
-
-      /* assert representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::AssertNode* node) {
-        stream << "assert(" << node->getChilds()[0] << ")";
-        return stream;
-      }
-
-
-      /* bvadd representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvaddNode* node) {
-        stream << "((" << node->getChilds()[0] << " + " << node->getChilds()[1] << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
-        return stream;
-      }
-
-
-      /* bvand representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvandNode* node) {
-        stream << "(" << node->getChilds()[0] << " & " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvashr representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvashrNode* node) {
-        stream << "(" << node->getChilds()[0] << " >> " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvdecl representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvdeclNode* node) {
-        stream << "bvdecl(" << node->getChilds()[0] << ")";
-        return stream;
-      }
-
-
-      /* bvlshr representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvlshrNode* node) {
-        stream << "(" << node->getChilds()[0] << " >> " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvmul representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvmulNode* node) {
-        stream << "((" << node->getChilds()[0] << " * " << node->getChilds()[1] << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
-        return stream;
-      }
-
-
-      /* bvnand representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvnandNode* node) {
-        stream << "(~(" << node->getChilds()[0] << " & " << node->getChilds()[1] << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
-        return stream;
-      }
-
-
-      /* bvneg representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvnegNode* node) {
-        stream << "-" << node->getChilds()[0];
-        return stream;
-      }
-
-
-      /* bvnor representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvnorNode* node) {
-        stream << "(~(" << node->getChilds()[0] << " | " << node->getChilds()[1] << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
-        return stream;
-      }
-
-
-      /* bvnot representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvnotNode* node) {
-        stream << "(~(" << node->getChilds()[0] << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
-        return stream;
-      }
-
-
-      /* bvor representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvorNode* node) {
-        stream << "(" << node->getChilds()[0] << " | " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvrol representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvrolNode* node) {
-        stream << "rol(" << node->getChilds()[0] << ", " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvror representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvrorNode* node) {
-        stream << "ror(" << node->getChilds()[0] << ", " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsdiv representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvsdivNode* node) {
-        stream << "(" << node->getChilds()[0] << " / " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsge representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvsgeNode* node) {
-        stream << "(" << node->getChilds()[0] << " >= " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsgt representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvsgtNode* node) {
-        stream << "(" << node->getChilds()[0] << " > " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvshl representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvshlNode* node) {
-        stream << "((" << node->getChilds()[0] << " << " << node->getChilds()[1] << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
-        return stream;
-      }
-
-
-      /* bvsle representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvsleNode* node) {
-        stream << "(" << node->getChilds()[0] << " <= " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvslt representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvsltNode* node) {
-        stream << "(" << node->getChilds()[0] << " < " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsmod representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvsmodNode* node) {
-        stream << "(" << node->getChilds()[0] << " % " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsrem representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvsremNode* node) {
-        stream << "(" << node->getChilds()[0] << " % " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsub representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvsubNode* node) {
-        stream << "((" << node->getChilds()[0] << " - " << node->getChilds()[1] << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
-        return stream;
-      }
-
-
-      /* bvudiv representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvudivNode* node) {
-        stream << "(" << node->getChilds()[0] << " / " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvuge representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvugeNode* node) {
-        stream << "(" << node->getChilds()[0] << " >= " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvugt representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvugtNode* node) {
-        stream << "(" << node->getChilds()[0] << " > " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvule representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvuleNode* node) {
-        stream << "(" << node->getChilds()[0] << " <= " << node->getChilds()[1] << ")";
-        return stream;
       }
 
 
-      /* bvult representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvultNode* node) {
-        stream << "(" << node->getChilds()[0] << " < " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvurem representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvuremNode* node) {
-        stream << "(" << node->getChilds()[0] << " % " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvxnor representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvxnorNode* node) {
-        stream << "(~(" << node->getChilds()[0] << " ^ " << node->getChilds()[1] << ") & 0x" << std::hex << node->getBitvectorMask() << std::dec << ")";
-        return stream;
-      }
-
-
-      /* bvxor representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvxorNode* node) {
-        stream << "(" << node->getChilds()[0] << " ^ " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bv representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvNode* node) {
-        stream << node->getChilds()[0];
-        return stream;
-      }
-
-
-      /* compound representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::CompoundNode* node) {
-        for (triton::usize index = 0; index < node->getChilds().size(); index++)
-          stream << node->getChilds()[index] << std::endl;
-        return stream;
-      }
-
-
-      /* concat representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ConcatNode* node) {
-        triton::usize size = node->getChilds().size();
-
-        for (triton::usize index = 0; index < size; index++)
-          stream << "(";
-
-        for (triton::usize index = 0; index < size-1; index++)
-          stream << node->getChilds()[index] << ") << " << node->getChilds()[index+1]->getBitvectorSize() << " | ";
-
-        stream << node->getChilds()[size-1] << ")";
-        return stream;
-      }
-
-
-      /* decimal representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::DecimalNode* node) {
-        stream << std::hex << "0x" << node->getValue() << std::dec;
-        return stream;
-      }
-
-
-      /* declare representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::DeclareFunctionNode* node) {
-        stream << node->getChilds()[0];
-        return stream;
-      }
-
-
-      /* distinct representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::DistinctNode* node) {
-        stream << "(" << node->getChilds()[0] << " != " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* equal representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::EqualNode* node) {
-        stream << "(" << node->getChilds()[0] << " == " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* extract representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ExtractNode* node) {
-        triton::uint32 low = reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[1])->getValue().convert_to<triton::uint32>();
-
-        if (low == 0)
-          stream << "(" << node->getChilds()[2] << " & " << std::hex << "0x" << node->getBitvectorMask() << std::dec << ")";
-        else
-          stream << "((" << node->getChilds()[2] << " >> " << low << ")" << " & " << std::hex << "0x" << node->getBitvectorMask() << std::dec << ")";
-
-        return stream;
-      }
-
-
-      /* ite representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::IteNode* node) {
-        stream << "(" << node->getChilds()[1] << " if " << node->getChilds()[0] << " else " << node->getChilds()[2] << ")";
-        return stream;
-      }
-
-
-      /* land representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::LandNode* node) {
-        stream << "(" << node->getChilds()[0] << " and " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* let representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::LetNode* node) {
-        stream << node->getChilds()[2];
-        return stream;
-      }
-
-
-      /* lnot representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::LnotNode* node) {
-        stream << "not " << node->getChilds()[0];
-        return stream;
-      }
-
-
-      /* lor representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::LorNode* node) {
-        stream << "(" << node->getChilds()[0] << " or " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* reference representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ReferenceNode* node) {
-        stream << "ref_" << node->getValue();
-        return stream;
+      AstPythonRepresentation::AstPythonRepresentation() {
       }
 
 
-      /* string representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::StringNode* node) {
-        stream << node->getValue();
-        return stream;
+      AstPythonRepresentation::~AstPythonRepresentation() {
       }
 
 
-      /* sx representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::SxNode* node) {
-        triton::uint512 extend = reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[0])->getValue();
-
-        if (extend)
-          stream << "sx(" << node->getChilds()[0] << ", " << node->getChilds()[1] << ")";
-        else
-          stream << node->getChilds()[1];
-
+      /* Representation entry point */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
+        triton::ast::inOrderWalk(node, [this, &stream](triton::ast::AbstractNode* node, triton::usize part) {
+          return this->printPart(stream, node, part);
+        });
         return stream;
       }
 
 
-      /* variable representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::VariableNode* node) {
-        stream << node->getValue();
-        return stream;
-      }
+      triton::ast::AbstractNode* AstPythonRepresentation::printPart(std::ostream& stream, triton::ast::AbstractNode* node, triton::usize part) const {
+        triton::ast::ChildVector& childs = node->getChilds();
 
+        switch (node->getKind()) {
+          case ASSERT_NODE:           return printUnary(stream, part, "assert(", childs[0], ")");
+          case BVADD_NODE:            return printBinary(stream, node, part, "((", " + ", true);
+          case BVAND_NODE:            return printBinary(stream, node, part, "(", " & ", false);
+          case BVASHR_NODE:           return printBinary(stream, node, part, "(", " >> ", false);
+          case BVDECL_NODE:           return printUnary(stream, part, "bvdecl(", childs[0], ")");
+          case BVLSHR_NODE:           return printBinary(stream, node, part, "(", " >> ", false);
+          case BVMUL_NODE:            return printBinary(stream, node, part, "((", " * ", true);
+          case BVNAND_NODE:           return printBinary(stream, node, part, "(~(", " & ", true);
+          case BVNEG_NODE:            return printUnary(stream, part, "-", childs[0], "");
+          case BVNOR_NODE:            return printBinary(stream, node, part, "(~(", " | ", true);
+          case BVOR_NODE:             return printBinary(stream, node, part, "(", " | ", false);
+          case BVROL_NODE:            return printBinary(stream, node, part, "rol(", ", ", false);
+          case BVROR_NODE:            return printBinary(stream, node, part, "ror(", ", ", false);
+          case BVSDIV_NODE:           return printBinary(stream, node, part, "(", " / ", false);
+          case BVSGE_NODE:            return printBinary(stream, node, part, "(", " >= ", false);
+          case BVSGT_NODE:            return printBinary(stream, node, part, "(", " > ", false);
+          case BVSHL_NODE:            return printBinary(stream, node, part, "((", " << ", true);
+          case BVSLE_NODE:            return printBinary(stream, node, part, "(", " <= ", false);
+          case BVSLT_NODE:            return printBinary(stream, node, part, "(", " < ", false);
+          case BVSMOD_NODE:           return printBinary(stream, node, part, "(", " % ", false);
+          case BVSREM_NODE:           return printBinary(stream, node, part, "(", " % ", false);
+          case BVSUB_NODE:            return printBinary(stream, node, part, "((", " - ", true);
+          case BVUDIV_NODE:           return printBinary(stream, node, part, "(", " / ", false);
+          case BVUGE_NODE:            return printBinary(stream, node, part, "(", " >= ", false);
+          case BVUGT_NODE:            return printBinary(stream, node, part, "(", " > ", false);
+          case BVULE_NODE:            return printBinary(stream, node, part, "(", " <= ", false);
+          case BVULT_NODE:            return printBinary(stream, node, part, "(", " < ", false);
+          case BVUREM_NODE:           return printBinary(stream, node, part, "(", " % ", false);
+          case BVXNOR_NODE:           return printBinary(stream, node, part, "(~(", " ^ ", true);
+          case BVXOR_NODE:            return printBinary(stream, node, part, "(", " ^ ", false);
+          case BV_NODE:               return printUnary(stream, part, "", childs[0], "");
+          case DECLARE_FUNCTION_NODE: return printUnary(stream, part, "", childs[0], "");
+          case DISTINCT_NODE:         return printBinary(stream, node, part, "(", " != ", false);
+          case EQUAL_NODE:            return printBinary(stream, node, part, "(", " == ", false);
+          case LAND_NODE:             return printBinary(stream, node, part, "(", " and ", false);
+          case LET_NODE:              return printUnary(stream, part, "", childs[2], "");
+          case LNOT_NODE:             return printUnary(stream, part, "not ", childs[0], "");
+          case LOR_NODE:              return printBinary(stream, node, part, "(", " or ", false);
+          case ZX_NODE:               return printUnary(stream, part, "", childs[1], "");
+
+          case BVNOT_NODE:
+            if (part == 0) {
+              stream << "(~(";
+              return childs[0];
+            }
+            printMask(stream, node);
+            return nullptr;
+
+          /* Each child is followed by a new line */
+          case COMPOUND_NODE:
+            if (part != 0)
+              stream << std::endl;
+            return part < childs.size() ? childs[part] : nullptr;
+
+          /* ((((child0) << size1 | child1) << size2 | child2) ...) */
+          case CONCAT_NODE:
+            if (part == 0) {
+              for (triton::usize index = 0; index < childs.size(); index++)
+                stream << "(";
+            }
+            else if (part < childs.size())
+              stream << ") << " << childs[part]->getBitvectorSize() << " | ";
+            else
+              stream << ")";
+            return part < childs.size() ? childs[part] : nullptr;
+
+          case EXTRACT_NODE: {
+            triton::uint32 low = reinterpret_cast<triton::ast::DecimalNode*>(childs[1])->getValue().convert_to<triton::uint32>();
+            if (part == 0) {
+              stream << (low == 0 ? "(" : "((");
+              return childs[2];
+            }
+            if (low != 0)
+              stream << " >> " << low << ")";
+            stream << " & " << std::hex << "0x" << node->getBitvectorMask() << std::dec << ")";
+            return nullptr;
+          }
+
+          case ITE_NODE:
+            switch (part) {
+              case 0:  stream << "(";       return childs[1];
+              case 1:  stream << " if ";    return childs[0];
+              case 2:  stream << " else ";  return childs[2];
+              default: stream << ")";       return nullptr;
+            }
+
+          case SX_NODE:
+            if (reinterpret_cast<triton::ast::DecimalNode*>(childs[0])->getValue() == 0)
+              return printUnary(stream, part, "", childs[1], "");
+            return printBinary(stream, node, part, "sx(", ", ", false);
+
+          /* Leaves */
+          case DECIMAL_NODE:
+            stream << std::hex << "0x" << reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue() << std::dec;
+            return nullptr;
+
+          case REFERENCE_NODE:
+            stream << "ref_" << reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+            return nullptr;
+
+          case STRING_NODE:
+            stream << reinterpret_cast<triton::ast::StringNode*>(node)->getValue();
+            return nullptr;
+
+          case VARIABLE_NODE:
+            stream << reinterpret_cast<triton::ast::VariableNode*>(node)->getValue();
+            return nullptr;
 
-      /* zx representation */
-      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ZxNode* node) {
-        stream << node->getChilds()[1];
-        return stream;
+          default:
+            throw triton::exceptions::AstRepresentation("AstPythonRepresentation::printPart(): Invalid kind node.");
+        }
       }
 
     };
   };
 };
-
-
@@ -0,0 +1,146 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <triton/astSmtDagRepresentation.hpp>
+#include <triton/astWalker.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+    namespace representations {
+
+      /* Returns true if the node may be bound by a let */
+      static bool isBindable(triton::ast::AbstractNode* node) {
+        switch (node->getKind()) {
+          case ASSERT_NODE:
+          case BV_NODE:
+          case BVDECL_NODE:
+          case COMPOUND_NODE:
+          case DECLARE_FUNCTION_NODE:
+          case LET_NODE:
+            return false;
+          default:
+            return !node->getChilds().empty();
+        }
+      }
+
+
+      AstSmtDagRepresentation::AstSmtDagRepresentation() {
+      }
+
+
+      AstSmtDagRepresentation::~AstSmtDagRepresentation() {
+      }
+
+
+      /* Representation entry point */
+      std::ostream& AstSmtDagRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
+        switch (node->getKind()) {
+          /* A let cannot wrap a command, and the shared nodes of a let may use its name */
+          case ASSERT_NODE:
+          case COMPOUND_NODE:
+          case DECLARE_FUNCTION_NODE:
+          case LET_NODE: {
+            triton::ast::AbstractNode* child = nullptr;
+            for (triton::usize part = 0; (child = this->smt.printPart(stream, node, part)) != nullptr; part++)
+              this->print(stream, child);
+            break;
+          }
+
+          default:
+            this->printDag(stream, node);
+            break;
+        }
+        return stream;
+      }
+
+
+      void AstSmtDagRepresentation::printTerm(std::ostream& stream, triton::ast::AbstractNode* root, const std::unordered_map<triton::ast::AbstractNode*, triton::usize>& names) {
+        /* The nodes being printed and the index of their next child */
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::usize>> path;
+
+        path.push_back(std::make_pair(root, 0));
+        while (!path.empty()) {
+          triton::ast::AbstractNode* node = path.back().first;
+          triton::usize index = path.back().second;
+
+          if (index == 0 && node != root) {
+            auto it = names.find(node);
+            if (it != names.end()) {
+              stream << "dag!" << it->second;
+              path.pop_back();
+              continue;
+            }
+          }
+
+          if (node->getKind() == LET_NODE) {
+            this->print(stream, node);
+            path.pop_back();
+            continue;
+          }
+
+          triton::ast::AbstractNode* child = this->smt.printPart(stream, node, index);
+          if (child == nullptr) {
+            path.pop_back();
+            continue;
+          }
+
+          path.back().second++;
+          path.push_back(std::make_pair(child, 0));
+        }
+      }
+
+
+      void AstSmtDagRepresentation::printDag(std::ostream& stream, triton::ast::AbstractNode* root) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::usize> uses;
+        std::unordered_map<triton::ast::AbstractNode*, triton::usize> names;
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+
+        /* Counts the parents of each node. The nodes under a let are printed with the let. */
+        triton::ast::preOrderWalk(root, [&uses](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+          if (uses[node]++ != 0)
+            return false;
+          if (node->getKind() != LET_NODE)
+            successors.insert(successors.end(), node->getChilds().begin(), node->getChilds().end());
+          return true;
+        });
+
+        /* Binds the shared nodes, a node after the nodes it uses */
+        triton::ast::postOrderWalk(root,
+          [&visited](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+            if (!visited.insert(node).second)
+              return false;
+            if (node->getKind() != LET_NODE)
+              successors.insert(successors.end(), node->getChilds().begin(), node->getChilds().end());
+            return true;
+          },
+          [&](triton::ast::AbstractNode* node) {
+            if (node == root || uses[node] < 2 || !isBindable(node))
+              return;
+            triton::usize name = names.size();
+            stream << "(let ((dag!" << name << " ";
+            this->printTerm(stream, node, names);
+            stream << ")) ";
+            names[node] = name;
+          }
+        );
+
+        this->printTerm(stream, root, names);
+        for (triton::usize index = 0; index < names.size(); index++)
+          stream << ")";
+      }
+
+    };
+  };
+};
+
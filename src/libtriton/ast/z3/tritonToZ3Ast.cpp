@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <triton/astWalker.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/tritonToZ3Ast.hpp>
@@ -20,6 +21,7 @@ namespace triton {
 
       this->symbolicEngine = symbolicEngine;
       this->isEval = eval;
+      this->scopeDepth = 0;
     }
 
 
@@ -28,43 +30,108 @@ namespace triton {
 
 
     Z3Result& TritonToZ3Ast::eval(triton::ast::AbstractNode& e) {
+      /*
+       * The uncached nodes are translated childs first with an explicit stack, so that the
+       * translation of each node finds its childs in the cache and deep trees do not overflow
+       * the call stack. The symbols and the let bindings are translated by their parents, once
+       * the bindings are known.
+       */
+      triton::ast::postOrderWalk(&e,
+        [this](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+          if (node->getKind() == triton::ast::STRING_NODE || node->getKind() == triton::ast::LET_NODE)
+            return false;
+
+          if (this->exprs.find(node) != this->exprs.end() || this->scopeExprs.find(node) != this->scopeExprs.end())
+            return false;
+
+          /* A reference is translated as the AST of its expression */
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+            if (this->references.find(id) == this->references.end())
+              successors.push_back(this->symbolicEngine->getSymbolicExpressionFromId(id)->getAst());
+            return true;
+          }
+
+          for (triton::ast::AbstractNode* child : node->getChilds())
+            successors.push_back(child);
+          return true;
+        },
+        [this](triton::ast::AbstractNode* node) {
+          this->translate(*node);
+        });
+
+      return this->translate(e);
+    }
+
+
+    Z3Result& TritonToZ3Ast::translate(triton::ast::AbstractNode& e) {
+      std::map<triton::ast::AbstractNode*, z3::expr>::iterator it = this->exprs.find(&e);
+
+      /* Shared sub-trees are translated only once (per let body if they are under a let) */
+      if (it != this->exprs.end() || (it = this->scopeExprs.find(&e)) != this->scopeExprs.end()) {
+        this->result.setExpr(it->second);
+        return this->result;
+      }
+
       e.accept(*this);
+
+      /* The value of a symbol depends on its let binding, so it is never cached */
+      if (e.getKind() != triton::ast::STRING_NODE) {
+        if (this->scopeDepth == 0)
+          this->exprs.insert(std::make_pair(&e, this->result.getExpr()));
+        else
+          this->scopeExprs.insert(std::make_pair(&e, this->result.getExpr()));
+      }
+
       return this->result;
     }
 
 
+    z3::context& TritonToZ3Ast::getContext(void) {
+      return this->result.getContext();
+    }
+
+
+    void TritonToZ3Ast::clearCache(void) {
+      this->exprs.clear();
+      this->references.clear();
+      this->scopeExprs.clear();
+    }
+
+
     void TritonToZ3Ast::operator()(triton::ast::AbstractNode& e) {
       e.accept(*this);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::AssertNode& e) {
-      throw triton::exceptions::AstTranslations("TritonToZ3Ast::AssertNode(): Not implemented.");
+      z3::expr op1 = this->eval(*e.getChilds()[0]).getExpr();
+      this->result.setExpr(op1);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvaddNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvadd(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvadd(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvand(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvand(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvashrNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvashr(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvashr(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
@@ -76,18 +143,18 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvlshrNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvlshr(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvlshr(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvmulNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvmul(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvmul(this->result.getContext(), op1, op2));
 
 
       this->result.setExpr(newexpr);
@@ -95,52 +162,52 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsmodNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsmod(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsmod(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnand(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnand(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnegNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvneg(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvneg(this->result.getContext(), op1));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnotNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnot(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnot(this->result.getContext(), op1));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
@@ -148,8 +215,8 @@ namespace triton {
 
     void TritonToZ3Ast::operator()(triton::ast::BvrolNode& e) {
       triton::uint32 op1  = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
-      Z3Result op2        = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_left(this->result.getContext(), op1, op2.getExpr()));
+      z3::expr op2        = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_left(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
@@ -157,163 +224,162 @@ namespace triton {
 
     void TritonToZ3Ast::operator()(triton::ast::BvrorNode& e) {
       triton::uint32 op1  = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
-      Z3Result op2        = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_right(this->result.getContext(), op1, op2.getExpr()));
+      z3::expr op2        = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_right(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsdivNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsdiv(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsdiv(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsgeNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsge(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsge(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsgtNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsgt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsgt(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvshlNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvshl(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvshl(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsleNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsle(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsle(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsltNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvslt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvslt(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsremNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsrem(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsrem(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsubNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsub(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsub(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvudivNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvudiv(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvudiv(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvugeNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvuge(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvuge(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvugtNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvugt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvugt(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvuleNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvule(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvule(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvultNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvult(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvult(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvuremNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvurem(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvurem(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvxnorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxnor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxnor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvxorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvNode& e) {
-      Z3Result value        = this->eval(*e.getChilds()[0]);
-      Z3Result size         = this->eval(*e.getChilds()[1]);
-      triton::uint32 bvsize = static_cast<triton::uint32>(size.getUintValue());
+      std::string value(reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue());
+      triton::uint32 bvsize = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[1])->getValue().convert_to<triton::uint32>();
 
-      z3::expr newexpr = this->result.getContext().bv_val(value.getStringValue().c_str(), bvsize);
+      z3::expr newexpr = this->result.getContext().bv_val(value.c_str(), bvsize);
 
       this->result.setExpr(newexpr);
     }
@@ -325,7 +391,7 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ConcatNode& e) {
-      std::vector<triton::ast::AbstractNode*> childs = e.getChilds();
+      triton::ast::ChildVector& childs = e.getChilds();
 
       triton::uint32 idx;
 
@@ -355,9 +421,9 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::DistinctNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_distinct(this->result.getContext(), 2, ops));
 
       this->result.setExpr(newexpr);
@@ -365,40 +431,38 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::EqualNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_eq(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_eq(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::ExtractNode& e) {
-      Z3Result high     = this->eval(*e.getChilds()[0]);
-      Z3Result low      = this->eval(*e.getChilds()[1]);
-      Z3Result value    = this->eval(*e.getChilds()[2]);
-      triton::uint32 hv = static_cast<triton::uint32>(high.getUintValue());
-      triton::uint32 lv = static_cast<triton::uint32>(low.getUintValue());
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), hv, lv, value.getExpr()));
+      triton::uint32 hv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      triton::uint32 lv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[1])->getValue().convert_to<triton::uint32>();
+      z3::expr value    = this->eval(*e.getChilds()[2]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), hv, lv, value));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::IteNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]); // condition
-      Z3Result op2      = this->eval(*e.getChilds()[1]); // if true
-      Z3Result op3      = this->eval(*e.getChilds()[2]); // if false
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_ite(this->result.getContext(), op1.getExpr(), op2.getExpr(), op3.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr(); // condition
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr(); // if true
+      z3::expr op3      = this->eval(*e.getChilds()[2]).getExpr(); // if false
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_ite(this->result.getContext(), op1, op2, op3));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_and(this->result.getContext(), 2, ops));
 
       this->result.setExpr(newexpr);
@@ -406,26 +470,47 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::LetNode& e) {
-      std::string symbol    = reinterpret_cast<triton::ast::StringNode*>(e.getChilds()[0])->getValue();
-      this->symbols[symbol] = e.getChilds()[1];
-      Z3Result op2          = this->eval(*e.getChilds()[2]);
+      std::string symbol = reinterpret_cast<triton::ast::StringNode*>(e.getChilds()[0])->getValue();
+      z3::expr op1       = this->eval(*e.getChilds()[1]).getExpr();
+
+      /* The body is translated in a new scope, the outer one is back once done */
+      std::map<std::string, z3::expr> outerSymbols = this->symbols;
+      std::map<triton::ast::AbstractNode*, z3::expr> outerExprs;
+      outerExprs.swap(this->scopeExprs);
+
+      this->symbols.erase(symbol);
+      this->symbols.insert(std::make_pair(symbol, op1));
+      this->scopeDepth++;
+
+      try {
+        z3::expr op2 = this->eval(*e.getChilds()[2]).getExpr();
+        this->result.setExpr(op2);
+      }
+      catch (...) {
+        this->symbols.swap(outerSymbols);
+        this->scopeExprs.swap(outerExprs);
+        this->scopeDepth--;
+        throw;
+      }
 
-      this->result.setExpr(op2.getExpr());
+      this->symbols.swap(outerSymbols);
+      this->scopeExprs.swap(outerExprs);
+      this->scopeDepth--;
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LnotNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_not(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_not(this->result.getContext(), op1));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_or(this->result.getContext(), 2, ops));
 
       this->result.setExpr(newexpr);
@@ -433,27 +518,35 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ReferenceNode& e) {
+      std::map<triton::usize, z3::expr>::iterator it = this->references.find(e.getValue());
+
+      /* Several reference nodes may point to the same symbolic expression */
+      if (it != this->references.end()) {
+        this->result.setExpr(it->second);
+        return;
+      }
+
       triton::engines::symbolic::SymbolicExpression* refNode = this->symbolicEngine->getSymbolicExpressionFromId(e.getValue());
       if (refNode == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::ReferenceNode(): Reference node not found.");
-      Z3Result op1 = this->eval(*(refNode->getAst()));
-      this->result.setExpr(op1.getExpr());
+      z3::expr op1 = this->eval(*(refNode->getAst())).getExpr();
+      this->references.insert(std::make_pair(e.getValue(), op1));
+      this->result.setExpr(op1);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::StringNode& e) {
-      if (this->symbols.find(e.getValue()) == this->symbols.end())
+      std::map<std::string, z3::expr>::iterator it = this->symbols.find(e.getValue());
+      if (it == this->symbols.end())
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::StringNode(): Symbols not found.");
-      Z3Result op1 = this->eval(*(this->symbols[e.getValue()]));
-      this->result.setExpr(op1.getExpr());
+      this->result.setExpr(it->second);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::SxNode& e) {
-      Z3Result ext        = this->eval(*e.getChilds()[0]);
-      Z3Result value      = this->eval(*e.getChilds()[1]);
-      triton::uint32 extv = static_cast<triton::uint32>(ext.getUintValue());
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), extv, value.getExpr()));
+      triton::uint32 extv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      z3::expr value      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), extv, value));
 
       this->result.setExpr(newexpr);
     }
@@ -466,9 +559,6 @@ namespace triton {
       if (symVar == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): Can't get the symbolic variable (nullptr).");
 
-      if (symVar->getSize() > QWORD_SIZE_BIT)
-        throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): Size above 64 bits is not supported yet.");
-
       /* If the conversion is used to evaluate a node, we concretize symbolic variables */
       if (this->isEval) {
         if (symVar->getKind() == triton::engines::symbolic::MEM) {
@@ -497,10 +587,9 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ZxNode& e) {
-      Z3Result ext        = this->eval(*e.getChilds()[0]);
-      Z3Result value      = this->eval(*e.getChilds()[1]);
-      triton::uint32 extv = static_cast<triton::uint32>(ext.getUintValue());
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), extv, value.getExpr()));
+      triton::uint32 extv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      z3::expr value      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), extv, value));
 
       this->result.setExpr(newexpr);
     }
@@ -30,7 +30,7 @@ namespace triton {
     triton::ast::AbstractNode* Z3Interface::simplify(triton::ast::AbstractNode* node) const {
       triton::ast::TritonToZ3Ast  z3Ast{this->symbolicEngine, false};
       triton::ast::Z3ToTritonAst  tritonAst{this->symbolicEngine};
-      triton::ast::Z3Result       result = z3Ast.eval(*node);
+      triton::ast::Z3Result&      result = z3Ast.eval(*node);
 
       /* Simplify and convert back to Triton's AST */
       z3::expr expr = result.getExpr().simplify();
@@ -46,7 +46,7 @@ namespace triton {
         throw triton::exceptions::AstTranslations("Z3Interface::evaluate(): node cannot be null.");
 
       triton::ast::TritonToZ3Ast z3ast{this->symbolicEngine};
-      triton::ast::Z3Result result = z3ast.eval(*node);
+      triton::ast::Z3Result& result = z3ast.eval(*node);
       triton::uint512 nbResult{result.getStringValue()};
 
       return nbResult;
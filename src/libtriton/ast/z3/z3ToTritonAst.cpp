@@ -7,6 +7,7 @@
 
 #include <list>
 
+#include <triton/astWalker.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/z3ToTritonAst.hpp>
 
@@ -50,12 +51,38 @@ namespace triton {
 
 
     AbstractNode* Z3ToTritonAst::convert(void) {
+      this->nodes.clear();
+
+      /*
+       * The arguments are converted before their applications with an explicit stack, so that
+       * visit() finds them in the cache and deep expressions do not overflow the call stack.
+       */
+      triton::ast::postOrderWalk(this->expr,
+        [this](const z3::expr& expr, std::vector<z3::expr>& successors) {
+          if (this->nodes.find(Z3_get_ast_id(expr.ctx(), expr)) != this->nodes.end())
+            return false;
+          if (expr.is_app()) {
+            for (triton::uint32 index = 0; index < expr.num_args(); index++)
+              successors.push_back(expr.arg(index));
+          }
+          return true;
+        },
+        [this](const z3::expr& expr) {
+          this->visit(expr);
+        });
+
       return this->visit(this->expr);
     }
 
 
     AbstractNode* Z3ToTritonAst::visit(z3::expr const& expr) {
       AbstractNode* node = nullptr;
+      triton::uint32 id  = Z3_get_ast_id(expr.ctx(), expr);
+
+      /* Shared sub-trees are converted only once */
+      std::map<triton::uint32, AbstractNode*>::iterator it = this->nodes.find(id);
+      if (it != this->nodes.end())
+        return it->second;
 
       /* Currently, only support application node */
       if (expr.is_quantifier())
@@ -435,6 +462,7 @@ namespace triton {
           throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): '" + function.name().str() + "' AST node not supported yet");
       }
 
+      this->nodes[id] = node;
       return node;
     }
 
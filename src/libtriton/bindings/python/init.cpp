@@ -123,6 +123,12 @@ namespace triton {
         triton::bindings::python::registersDict = xPyDict_New();
         PyObject* idRegClass = xPyClass_New(nullptr, triton::bindings::python::registersDict, xPyString_FromString("REG"));
 
+        /* Create the SOLVER namespace =============================================================== */
+
+        PyObject* solverDict = xPyDict_New();
+        initSolverNamespace(solverDict);
+        PyObject* idSolverClass = xPyClass_New(nullptr, solverDict, xPyString_FromString("SOLVER"));
+
         /* Create the SYMEXPR namespace ============================================================== */
 
         PyObject* symExprDict = xPyDict_New();
@@ -157,6 +163,7 @@ namespace triton {
         PyModule_AddObject(triton::bindings::python::tritonModule, "PE",                  idPeDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "PREFIX",              idPrefixesClass);           /* Empty: filled on the fly */
         PyModule_AddObject(triton::bindings::python::tritonModule, "REG",                 idRegClass);                /* Empty: filled on the fly */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "SOLVER",              idSolverClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SYMEXPR",             idSymExprClass);
         #if defined(__unix__) || defined(__APPLE__)
         PyModule_AddObject(triton::bindings::python::tritonModule, "SYSCALL",             idSyscallsClass);           /* Empty: filled on the fly */
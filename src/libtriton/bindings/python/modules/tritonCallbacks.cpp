@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <set>
+
 #include <triton/api.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/bitsVector.hpp>
@@ -43,6 +45,7 @@ If you want to use the libTriton without Python bindings, recompile the project
 \subsection triton_py_api_classes Classes
 
 - \ref py_AstNode_page
+- \ref py_AstTape_page
 - \ref py_Bitvector_page
 - \ref py_Elf_page
 - \ref py_ElfDynamicTable_page
@@ -78,6 +81,18 @@ If you want to use the libTriton without Python bindings, recompile the project
 - <b>void addCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
 
+- <b>void addCallback(function cb, \ref py_CALLBACK_page kind, [\ref py_AST_NODE_page, ...] nodes, integer minSize=0)</b><br>
+Adds a SYMBOLIC_SIMPLIFICATION callback which is only called on the roots of kind `nodes` (all kinds if the list is empty) and of
+`minSize` bits or more. The other roots do not call into Python at all, e.g. `addCallback(cb, CALLBACK.SYMBOLIC_SIMPLIFICATION, [AST_NODE.BVXOR])`.
+
+- <b>void addDefaultSimplificationRules(void)</b><br>
+Adds the built-in rewriting rules applied by simplify() and on each new symbolic expression: folding of the operations on
+constants, identities and mixed boolean-arithmetic identities. See \ref SMT_simplification_page.
+
+- <b>void addSimplificationRule(string rule)</b><br>
+Adds a rewriting rule written as `pattern -> replacement`, e.g. `(bvxor x x) -> 0`. The rules are applied bottom-up by simplify()
+and on each new symbolic expression, before the simplification callbacks. See \ref SMT_simplification_page.
+
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the memory access.
@@ -103,6 +118,15 @@ Builds a symbolic register from a \ref py_REG_page with the SSA form.
 - <b>void clearPathConstraints(void)</b><br>
 Clears the logical conjunction vector of path constraints.
 
+- <b>void clearSimplificationRules(void)</b><br>
+Removes all rewriting rules, including the built-in ones.
+
+- <b>void clearSolverCache(void)</b><br>
+Clears the cache of the queries already solved by getModel().
+
+- <b>\ref py_AstTape_page compileAst(\ref py_AstNode_page node)</b><br>
+Compiles a node into a list of instructions which is evaluated again and again under different values of its symbolic variables, without building any node.
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -166,6 +190,11 @@ Returns a dictionary which contains all information about number of nodes alloca
 - <b>\ref py_AstNode_page getAstFromId(integer symExprId)</b><br>
 Returns the partial AST from a symbolic expression id.
 
+- <b>dict getAstMemoryStats(void)</b><br>
+Returns a dictionary which contains the memory used by the live AST nodes: the number of nodes (`nodes`), their memory in bytes (`nodes_memory`),
+the childs, parents and values which do not fit in the nodes (`out_of_line_blocks`, `out_of_line_memory`), the memory reserved by the allocator
+(`reserved_memory`) and the average memory per node (`bytes_per_node`).
+
 - <b>\ref py_AST_REPRESENTATION_page getAstRepresentationMode(void)</b><br>
 Returns the current AST representation mode.
 
@@ -182,16 +211,33 @@ Returns the concrete value of memory cells.
 Returns the concrete value of a register.
 
 - <b>\ref py_AstNode_page getFullAst(\ref py_AstNode_page node)</b><br>
-Returns the full AST without SSA form from a given root node.
+Returns the full AST without SSA form from a given root node. The given AST is not modified and the full AST of each
+symbolic expression is built once, so unrolling the same expressions again is cheap.
 
 - <b>\ref py_AstNode_page getFullAstFromId(integer symExprId)</b><br>
 Returns the full AST without SSA form from a symbolic expression id.
 
-- <b>dict getModel(\ref py_AstNode_page node)</b><br>
+- <b>dict getModel(\ref py_AstNode_page node, [integer timeout, integer memoryLimit, integer conflictLimit])</b><br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
+The optional limits (time in milliseconds, memory in megabytes, conflicts) apply to this call only, 0 falls back on the global limit.
+The dictionary is empty if the constraint is unsat or if a limit is reached, see getSolverQueryStats().
+
+- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit, [integer timeout, integer memoryLimit, integer conflictLimit])</b><br>
+Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. The optional limits
+are the same as getModel().
+
+- <b>[dict, ...] getModelsForAllBranches([\ref py_PathConstraint_page, ...] pathConstraints, integer maxThreads)</b><br>
+Computes and returns a model for every untaken branch of `pathConstraints`, each one under the taken branches which precede it.
+Branches are translated while the GIL is held, then solved in parallel on at most `maxThreads` threads (0 means the number
+of hardware threads) with the GIL released. Models are in the order of the branches and a dictionary is empty if its branch cannot be taken.
+
+- <b>[dict, ...] getModelsForUntakenBranches(void)</b><br>
+Computes and returns a model for every untaken branch of the path constraints. Models are in the order of the trace
+and a dictionary is empty if its branch cannot be taken. Path constraints are asserted incrementally into a persistent
+solver session, so calling this function again after new instructions only solves the new branches.
 
-- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit)</b><br>
-Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
+- <b>dict getModelUnderPathConstraints(\ref py_AstNode_page node)</b><br>
+Computes and returns a model from a symbolic constraint conjoined with the path constraints, using the persistent solver session.
 
 - <b>[\ref py_Register_page, ...] getParentRegisters(void)</b><br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
@@ -208,6 +254,19 @@ Returns the max size (in bit) of the CPU register (GPR).
 - <b>integer getRegisterSize(void)</b><br>
 Returns the max size (in byte) of the CPU register (GPR).
 
+- <b>[string, ...] getSimplificationRules(void)</b><br>
+Returns the rewriting rules.
+
+- <b>dict getSolverCacheStats(void)</b><br>
+Returns a dictionary which contains the statistics of the solver query cache used by getModel(): the number of `entries`,
+their size in `bytes`, the size limit `max_bytes`, the number of entries `evicted` to stay under it, `hits`, `misses` and the
+number of misses `reused` from a previous model without calling the solver.
+
+- <b>dict getSolverQueryStats(void)</b><br>
+Returns a dictionary which contains the statistics of the last query solved by getModel() or getModels(): its `status`
+(\ref py_SOLVER_page), the number of unique `nodes` and of `variables` of the formula, the `translation_time` and the `solving_time`
+in microseconds.
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpressionFromId(intger symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
@@ -316,6 +375,9 @@ Removes a recorded callback.
 - <b>void resetEngines(void)</b><br>
 Resets everything.
 
+- <b>void resetSolverSession(void)</b><br>
+Drops all assertions of the persistent solver session. It is automatically done when path constraints are cleared.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -342,6 +404,18 @@ the symbolic state (if it exists). You should probably use the concretize functi
 Sets the concrete value of a register. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
+- <b>void setSolverCacheLimit(integer maxBytes)</b><br>
+Sets the size limit (in bytes) of the solver query cache, the least recently used queries are evicted beyond it. 0 means no limit.
+
+- <b>void setSolverConflictLimit(integer conflictLimit)</b><br>
+Sets the global conflict limit of a solver query. 0 means no limit.
+
+- <b>void setSolverMemoryLimit(integer memoryLimit)</b><br>
+Sets the global memory limit (in megabytes) of a solver query. 0 means no limit.
+
+- <b>void setSolverTimeout(integer timeout)</b><br>
+Sets the global time limit (in milliseconds) of a solver query. 0 means no limit.
+
 - <b>bool setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)</b><br>
 Sets the targeted memory as tainted or not. Returns true if the memory is still tainted.
 
@@ -434,6 +508,7 @@ Untaints a register. Returns true if the register is still tainted.
 - \ref py_OPERAND_page
 - \ref py_PE_page
 - \ref py_REG_page
+- \ref py_SOLVER_page
 - \ref py_SYMEXPR_page
 - \ref py_SYSCALL_page
 - \ref py_VERSION_page
@@ -736,11 +811,15 @@ namespace triton {
 
 
       static PyObject* triton_addCallback(PyObject* self, PyObject* args) {
-        PyObject* function = nullptr;
-        PyObject* mode     = nullptr;
+        std::set<triton::ast::kind_e> kinds;
+        triton::uint32 minSize = 0;
+        PyObject* function     = nullptr;
+        PyObject* mode         = nullptr;
+        PyObject* kindList     = nullptr;
+        PyObject* size         = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &function, &mode);
+        PyArg_ParseTuple(args, "|OOOO", &function, &mode, &kindList, &size);
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -752,7 +831,28 @@ namespace triton {
         if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
           return PyErr_Format(PyExc_TypeError, "addCallback(): Expects a CALLBACK as second argument.");
 
+        if (kindList != nullptr && !PyList_Check(kindList))
+          return PyErr_Format(PyExc_TypeError, "addCallback(): Expects a list of AST_NODE as third argument.");
+
+        if (size != nullptr && (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "addCallback(): Expects an integer as fourth argument.");
+
+        if ((kindList != nullptr || size != nullptr) && static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)) != callbacks::SYMBOLIC_SIMPLIFICATION)
+          return PyErr_Format(PyExc_TypeError, "addCallback(): Only a SYMBOLIC_SIMPLIFICATION callback takes kinds of node and a size.");
+
         try {
+          if (kindList != nullptr) {
+            for (Py_ssize_t i = 0; i < PyList_Size(kindList); i++) {
+              PyObject* item = PyList_GetItem(kindList, i);
+              if (!PyLong_Check(item) && !PyInt_Check(item))
+                return PyErr_Format(PyExc_TypeError, "addCallback(): Each kind of node must be an AST_NODE.");
+              kinds.insert(static_cast<triton::ast::kind_e>(PyLong_AsUint32(item)));
+            }
+          }
+
+          if (size != nullptr)
+            minSize = PyLong_AsUint32(size);
+
           switch (static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode))) {
 
             case callbacks::GET_CONCRETE_MEMORY_VALUE:
@@ -821,7 +921,7 @@ namespace triton {
                 Py_DECREF(args);
                 return node;
                 /********* End of lambda *********/
-              }, function));
+              }, function), kinds, minSize);
               break;
 
             default:
@@ -837,6 +937,43 @@ namespace triton {
       }
 
 
+      static PyObject* triton_addDefaultSimplificationRules(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addDefaultSimplificationRules(): Architecture is not defined.");
+
+        try {
+          triton::api.addDefaultSimplificationRules();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_addSimplificationRule(PyObject* self, PyObject* rule) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addSimplificationRule(): Architecture is not defined.");
+
+        if (!PyString_Check(rule))
+          return PyErr_Format(PyExc_TypeError, "addSimplificationRule(): Expects a string as argument.");
+
+        try {
+          triton::api.addSimplificationRule(PyString_AsString(rule));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -981,6 +1118,43 @@ namespace triton {
       }
 
 
+      static PyObject* triton_clearSimplificationRules(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearSimplificationRules(): Architecture is not defined.");
+        triton::api.clearSimplificationRules();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearSolverCache(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearSolverCache(): Architecture is not defined.");
+        triton::api.clearSolverCache();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_compileAst(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "compileAst(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "compileAst(): Expects a AstNode as argument.");
+
+        try {
+          return PyAstTape(triton::api.compileAst(PyAstNode_AsAstNode(node)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1474,6 +1648,28 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getAstMemoryStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getAstMemoryStats(): Architecture is not defined.");
+
+        try {
+          std::map<std::string, triton::usize> stats = triton::api.getAstMemoryStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getAstFromId(PyObject* self, PyObject* symExprId) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1602,19 +1798,38 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getModel(PyObject* self, PyObject* node) {
-        PyObject* ret = nullptr;
+      static PyObject* triton_getModel(PyObject* self, PyObject* args) {
+        PyObject* ret           = nullptr;
+        PyObject* node          = nullptr;
+        PyObject* timeout       = nullptr;
+        PyObject* memoryLimit   = nullptr;
+        PyObject* conflictLimit = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOO", &node, &timeout, &memoryLimit, &conflictLimit);
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "getModel(): Architecture is not defined.");
 
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as argument.");
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as first argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects an integer as second argument.");
+
+        if (memoryLimit != nullptr && !PyLong_Check(memoryLimit) && !PyInt_Check(memoryLimit))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects an integer as third argument.");
+
+        if (conflictLimit != nullptr && !PyLong_Check(conflictLimit) && !PyInt_Check(conflictLimit))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects an integer as fourth argument.");
 
         try {
           ret = xPyDict_New();
-          auto model = triton::api.getModel(PyAstNode_AsAstNode(node));
+          auto model = triton::api.getModel(PyAstNode_AsAstNode(node),
+                                            timeout       ? PyLong_AsUint32(timeout)       : 0,
+                                            memoryLimit   ? PyLong_AsUint32(memoryLimit)   : 0,
+                                            conflictLimit ? PyLong_AsUint32(conflictLimit) : 0);
           for (auto it = model.begin(); it != model.end(); it++) {
             PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
           }
@@ -1628,12 +1843,15 @@ namespace triton {
 
 
       static PyObject* triton_getModels(PyObject* self, PyObject* args) {
-        PyObject* ret   = nullptr;
-        PyObject* node  = nullptr;
-        PyObject* limit = nullptr;
+        PyObject* ret           = nullptr;
+        PyObject* node          = nullptr;
+        PyObject* limit         = nullptr;
+        PyObject* timeout       = nullptr;
+        PyObject* memoryLimit   = nullptr;
+        PyObject* conflictLimit = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &node, &limit);
+        PyArg_ParseTuple(args, "|OOOOO", &node, &limit, &timeout, &memoryLimit, &conflictLimit);
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1645,8 +1863,21 @@ namespace triton {
         if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
           return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as second argument.");
 
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as third argument.");
+
+        if (memoryLimit != nullptr && !PyLong_Check(memoryLimit) && !PyInt_Check(memoryLimit))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as fourth argument.");
+
+        if (conflictLimit != nullptr && !PyLong_Check(conflictLimit) && !PyInt_Check(conflictLimit))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as fifth argument.");
+
         try {
-          auto models = triton::api.getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit));
+          auto models = triton::api.getModels(PyAstNode_AsAstNode(node),
+                                              PyLong_AsUint32(limit),
+                                              timeout       ? PyLong_AsUint32(timeout)       : 0,
+                                              memoryLimit   ? PyLong_AsUint32(memoryLimit)   : 0,
+                                              conflictLimit ? PyLong_AsUint32(conflictLimit) : 0);
           triton::uint32 index = 0;
 
           ret = xPyList_New(models.size());
@@ -1669,6 +1900,138 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getModelsForAllBranches(PyObject* self, PyObject* args) {
+        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
+        std::vector<triton::engines::symbolic::PathConstraint> pcs;
+        triton::engines::solver::SolverBranches branches;
+        std::string error;
+        bool failed          = false;
+        PyObject* ret        = nullptr;
+        PyObject* pathConstr = nullptr;
+        PyObject* maxThreads = nullptr;
+        triton::uint32 index = 0;
+        triton::uint32 count = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &pathConstr, &maxThreads);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModelsForAllBranches(): Architecture is not defined.");
+
+        if (pathConstr == nullptr || !PyList_Check(pathConstr))
+          return PyErr_Format(PyExc_TypeError, "getModelsForAllBranches(): Expects a list of PathConstraint as first argument.");
+
+        if (maxThreads == nullptr || (!PyLong_Check(maxThreads) && !PyInt_Check(maxThreads)))
+          return PyErr_Format(PyExc_TypeError, "getModelsForAllBranches(): Expects an integer as second argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(pathConstr); i++) {
+          PyObject* item = PyList_GetItem(pathConstr, i);
+
+          if (!PyPathConstraint_Check(item))
+            return PyErr_Format(PyExc_TypeError, "getModelsForAllBranches(): Each item of the list must be a PathConstraint.");
+
+          pcs.push_back(*PyPathConstraint_AsPathConstraint(item));
+        }
+
+        /* The integer is a Python object, it is converted while the GIL is held */
+        try {
+          count = PyLong_AsUint32(maxThreads);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        /* The translation reads the symbolic engine, the GIL is held meanwhile */
+        try {
+          triton::api.translateBranches(pcs, count, branches);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        /* The solving only touches the Z3 contexts of the workers, other Python threads can run meanwhile */
+        Py_BEGIN_ALLOW_THREADS
+        try {
+          models = branches.solve();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          failed = true;
+          error  = e.what();
+        }
+        Py_END_ALLOW_THREADS
+
+        if (failed)
+          return PyErr_Format(PyExc_TypeError, "%s", error.c_str());
+
+        ret = xPyList_New(models.size());
+        for (auto it = models.begin(); it != models.end(); it++) {
+          PyObject* mdict = xPyDict_New();
+
+          for (auto it2 = it->begin(); it2 != it->end(); it2++) {
+            PyDict_SetItem(mdict, PyLong_FromUint32(it2->first), PySolverModel(it2->second));
+          }
+          PyList_SetItem(ret, index++, mdict);
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getModelsForUntakenBranches(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModelsForUntakenBranches(): Architecture is not defined.");
+
+        try {
+          const auto& models = triton::api.getModelsForUntakenBranches();
+          triton::uint32 index = 0;
+
+          ret = xPyList_New(models.size());
+          for (auto it = models.begin(); it != models.end(); it++) {
+            PyObject* mdict = xPyDict_New();
+
+            for (auto it2 = it->begin(); it2 != it->end(); it2++) {
+              PyDict_SetItem(mdict, PyLong_FromUint32(it2->first), PySolverModel(it2->second));
+            }
+            PyList_SetItem(ret, index++, mdict);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getModelUnderPathConstraints(PyObject* self, PyObject* node) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModelUnderPathConstraints(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModelUnderPathConstraints(): Expects a AstNode as argument.");
+
+        try {
+          ret = xPyDict_New();
+          auto model = triton::api.getModelUnderPathConstraints(PyAstNode_AsAstNode(node));
+          for (auto it = model.begin(); it != model.end(); it++) {
+            PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getParentRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -1739,6 +2102,72 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getSimplificationRules(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSimplificationRules(): Architecture is not defined.");
+
+        try {
+          std::vector<std::string> rules = triton::api.getSimplificationRules();
+
+          ret = xPyList_New(rules.size());
+          for (triton::usize index = 0; index < rules.size(); index++)
+            PyList_SetItem(ret, index, PyString_FromString(rules[index].c_str()));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getSolverCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSolverCacheStats(): Architecture is not defined.");
+
+        try {
+          std::map<std::string, triton::usize> stats = triton::api.getSolverCacheStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getSolverQueryStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSolverQueryStats(): Architecture is not defined.");
+
+        try {
+          const auto& stats = triton::api.getSolverQueryStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2380,6 +2809,23 @@ namespace triton {
       }
 
 
+      static PyObject* triton_resetSolverSession(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "resetSolverSession(): Architecture is not defined.");
+
+        try {
+          triton::api.resetSolverSession();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2565,6 +3011,86 @@ namespace triton {
       }
 
 
+      static PyObject* triton_setSolverCacheLimit(PyObject* self, PyObject* maxBytes) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverCacheLimit(): Architecture is not defined.");
+
+        if (!PyLong_Check(maxBytes) && !PyInt_Check(maxBytes))
+          return PyErr_Format(PyExc_TypeError, "setSolverCacheLimit(): Expects an integer as argument.");
+
+        try {
+          triton::api.setSolverCacheLimit(PyLong_AsUsize(maxBytes));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setSolverConflictLimit(PyObject* self, PyObject* conflictLimit) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverConflictLimit(): Architecture is not defined.");
+
+        if (!PyLong_Check(conflictLimit) && !PyInt_Check(conflictLimit))
+          return PyErr_Format(PyExc_TypeError, "setSolverConflictLimit(): Expects an integer as argument.");
+
+        try {
+          triton::api.setSolverConflictLimit(PyLong_AsUint32(conflictLimit));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setSolverMemoryLimit(PyObject* self, PyObject* memoryLimit) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverMemoryLimit(): Architecture is not defined.");
+
+        if (!PyLong_Check(memoryLimit) && !PyInt_Check(memoryLimit))
+          return PyErr_Format(PyExc_TypeError, "setSolverMemoryLimit(): Expects an integer as argument.");
+
+        try {
+          triton::api.setSolverMemoryLimit(PyLong_AsUint32(memoryLimit));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setSolverTimeout(PyObject* self, PyObject* timeout) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverTimeout(): Architecture is not defined.");
+
+        if (!PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "setSolverTimeout(): Expects an integer as argument.");
+
+        try {
+          triton::api.setSolverTimeout(PyLong_AsUint32(timeout));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setTaintMemory(PyObject* self, PyObject* args) {
         PyObject* mem    = nullptr;
         PyObject* flag   = nullptr;
@@ -3107,6 +3633,8 @@ namespace triton {
         {"Pe",                                  (PyCFunction)triton_Pe,                                     METH_O,             ""},
         {"Register",                            (PyCFunction)triton_Register,                               METH_VARARGS,       ""},
         {"addCallback",                         (PyCFunction)triton_addCallback,                            METH_VARARGS,       ""},
+        {"addDefaultSimplificationRules",       (PyCFunction)triton_addDefaultSimplificationRules,          METH_NOARGS,        ""},
+        {"addSimplificationRule",               (PyCFunction)triton_addSimplificationRule,                  METH_O,             ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)triton_assignSymbolicExpressionToMemory,       METH_VARARGS,       ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)triton_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
         {"buildSemantics",                      (PyCFunction)triton_buildSemantics,                         METH_O,             ""},
@@ -3114,6 +3642,9 @@ namespace triton {
         {"buildSymbolicMemory",                 (PyCFunction)triton_buildSymbolicMemory,                    METH_O,             ""},
         {"buildSymbolicRegister",               (PyCFunction)triton_buildSymbolicRegister,                  METH_O,             ""},
         {"clearPathConstraints",                (PyCFunction)triton_clearPathConstraints,                   METH_NOARGS,        ""},
+        {"clearSimplificationRules",            (PyCFunction)triton_clearSimplificationRules,               METH_NOARGS,        ""},
+        {"clearSolverCache",                    (PyCFunction)triton_clearSolverCache,                       METH_NOARGS,        ""},
+        {"compileAst",                          (PyCFunction)triton_compileAst,                             METH_O,             ""},
         {"concretizeAllMemory",                 (PyCFunction)triton_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)triton_concretizeAllRegister,                  METH_NOARGS,        ""},
         {"concretizeMemory",                    (PyCFunction)triton_concretizeMemory,                       METH_O,             ""},
@@ -3134,19 +3665,26 @@ namespace triton {
         {"getArchitecture",                     (PyCFunction)triton_getArchitecture,                        METH_NOARGS,        ""},
         {"getAstDictionariesStats",             (PyCFunction)triton_getAstDictionariesStats,                METH_NOARGS,        ""},
         {"getAstFromId",                        (PyCFunction)triton_getAstFromId,                           METH_O,             ""},
+        {"getAstMemoryStats",                   (PyCFunction)triton_getAstMemoryStats,                      METH_NOARGS,        ""},
         {"getAstRepresentationMode",            (PyCFunction)triton_getAstRepresentationMode,               METH_NOARGS,        ""},
         {"getConcreteMemoryAreaValue",          (PyCFunction)triton_getConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"getConcreteMemoryValue",              (PyCFunction)triton_getConcreteMemoryValue,                 METH_O,             ""},
         {"getConcreteRegisterValue",            (PyCFunction)triton_getConcreteRegisterValue,               METH_O,             ""},
         {"getFullAst",                          (PyCFunction)triton_getFullAst,                             METH_O,             ""},
         {"getFullAstFromId",                    (PyCFunction)triton_getFullAstFromId,                       METH_O,             ""},
-        {"getModel",                            (PyCFunction)triton_getModel,                               METH_O,             ""},
+        {"getModel",                            (PyCFunction)triton_getModel,                               METH_VARARGS,       ""},
         {"getModels",                           (PyCFunction)triton_getModels,                              METH_VARARGS,       ""},
+        {"getModelsForAllBranches",             (PyCFunction)triton_getModelsForAllBranches,                METH_VARARGS,       ""},
+        {"getModelsForUntakenBranches",         (PyCFunction)triton_getModelsForUntakenBranches,            METH_NOARGS,        ""},
+        {"getModelUnderPathConstraints",        (PyCFunction)triton_getModelUnderPathConstraints,           METH_O,             ""},
         {"getParentRegisters",                  (PyCFunction)triton_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)triton_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)triton_getPathConstraintsAst,                  METH_NOARGS,        ""},
         {"getRegisterBitSize",                  (PyCFunction)triton_getRegisterBitSize,                     METH_NOARGS,        ""},
         {"getRegisterSize",                     (PyCFunction)triton_getRegisterSize,                        METH_NOARGS,        ""},
+        {"getSimplificationRules",              (PyCFunction)triton_getSimplificationRules,                 METH_NOARGS,        ""},
+        {"getSolverCacheStats",                 (PyCFunction)triton_getSolverCacheStats,                    METH_NOARGS,        ""},
+        {"getSolverQueryStats",                 (PyCFunction)triton_getSolverQueryStats,                    METH_NOARGS,        ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)triton_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)triton_getSymbolicExpressions,                 METH_NOARGS,        ""},
         {"getSymbolicMemory",                   (PyCFunction)triton_getSymbolicMemory,                      METH_NOARGS,        ""},
@@ -3180,11 +3718,16 @@ namespace triton {
         {"removeAllCallbacks",                  (PyCFunction)triton_removeAllCallbacks,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)triton_removeCallback,                         METH_VARARGS,       ""},
         {"resetEngines",                        (PyCFunction)triton_resetEngines,                           METH_NOARGS,        ""},
+        {"resetSolverSession",                  (PyCFunction)triton_resetSolverSession,                     METH_NOARGS,        ""},
         {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)triton_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)triton_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"setConcreteMemoryValue",              (PyCFunction)triton_setConcreteMemoryValue,                 METH_VARARGS,       ""},
         {"setConcreteRegisterValue",            (PyCFunction)triton_setConcreteRegisterValue,               METH_O,             ""},
+        {"setSolverCacheLimit",                 (PyCFunction)triton_setSolverCacheLimit,                    METH_O,             ""},
+        {"setSolverConflictLimit",              (PyCFunction)triton_setSolverConflictLimit,                 METH_O,             ""},
+        {"setSolverMemoryLimit",                (PyCFunction)triton_setSolverMemoryLimit,                   METH_O,             ""},
+        {"setSolverTimeout",                    (PyCFunction)triton_setSolverTimeout,                       METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)triton_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)triton_setTaintRegister,                       METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)triton_simplify,                               METH_VARARGS,       ""},
@@ -36,6 +36,10 @@ Enabled, all prints of AST expressions will be represented into the SMT2-Lib syn
 - **AST_REPRESENTATION.PYTHON**<br>
 Enabled, all prints of AST expressions will be represented into the Python syntax.
 
+- **AST_REPRESENTATION.SMT_DAG**<br>
+Enabled, all prints of AST expressions will be represented into the SMT2-Lib syntax, where a node used more than once is
+printed once and bound by a `let`. Use it to print the full ASTs of loops, whose expanded text grows exponentially.
+
 
 */
 
@@ -46,8 +50,9 @@ namespace triton {
     namespace python {
 
       void initAstRepresentationNamespace(PyObject* astRepresentationDict) {
-        PyDict_SetItemString(astRepresentationDict, "SMT",    PyLong_FromUint32(triton::ast::representations::SMT_REPRESENTATION));
-        PyDict_SetItemString(astRepresentationDict, "PYTHON", PyLong_FromUint32(triton::ast::representations::PYTHON_REPRESENTATION));
+        PyDict_SetItemString(astRepresentationDict, "SMT",     PyLong_FromUint32(triton::ast::representations::SMT_REPRESENTATION));
+        PyDict_SetItemString(astRepresentationDict, "PYTHON",  PyLong_FromUint32(triton::ast::representations::PYTHON_REPRESENTATION));
+        PyDict_SetItemString(astRepresentationDict, "SMT_DAG", PyLong_FromUint32(triton::ast::representations::SMT_DAG_REPRESENTATION));
       }
 
     }; /* python namespace */
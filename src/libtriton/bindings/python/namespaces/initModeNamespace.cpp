@@ -34,7 +34,8 @@ The MODE namespace contains all kinds of mode.
 Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` acceess.
 
 - **MODE.AST_DICTIONARIES**<br>
-Enabled, Triton will record all AST nodes into several dictionaries and try to return node already allocated instead of allocate twice the same node.
+Enabled, Triton will hash-cons all AST nodes: a node structurally equal to a node already allocated (same kind, size, children and value) is not allocated twice and the existing node is returned instead.
+This mode is enabled by default.
 
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
@@ -45,6 +46,10 @@ Enabled, Triton will perform symbolic execution only on tainted instructions.
 - **MODE.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This mode is enabled by default.
 
+- **MODE.PC_SLICING**<br>
+Enabled, Triton will partition the path constraints by the symbolic variables they use and will send to the solver only the partitions
+relevant to the query. See getModelUnderPathConstraints() and getModelsForUntakenBranches().
+
 */
 
 
@@ -58,6 +63,7 @@ namespace triton {
         PyDict_SetItemString(modeDict, "AST_DICTIONARIES",       PyLong_FromUint32(triton::modes::AST_DICTIONARIES));
         PyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
         PyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",        PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
+        PyDict_SetItemString(modeDict, "PC_SLICING",             PyLong_FromUint32(triton::modes::PC_SLICING));
         PyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
       }
 
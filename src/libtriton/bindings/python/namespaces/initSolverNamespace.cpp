@@ -0,0 +1,58 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/solverEnums.hpp>
+
+
+
+/*! \page py_SOLVER_page SOLVER
+    \brief [**python api**] All information about the SOLVER python namespace.
+
+\tableofcontents
+
+\section SOLVER_py_description Description
+<hr>
+
+The SOLVER namespace contains all status of a solver query.
+
+\subsection SOLVER_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> setSolverTimeout(1000)
+>>> model = getModel(constraint)
+>>> getSolverQueryStats()['status'] == SOLVER.TIMEOUT
+False
+~~~~~~~~~~~~~
+
+\section SOLVER_py_api Python API - Items of the SOLVER namespace
+<hr>
+
+- **SOLVER.SAT**
+- **SOLVER.UNSAT**
+- **SOLVER.TIMEOUT**
+- **SOLVER.UNKNOWN**
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initSolverNamespace(PyObject* solverDict) {
+        PyDict_SetItemString(solverDict, "SAT",      PyLong_FromUint32(triton::engines::solver::SAT));
+        PyDict_SetItemString(solverDict, "UNSAT",    PyLong_FromUint32(triton::engines::solver::UNSAT));
+        PyDict_SetItemString(solverDict, "TIMEOUT",  PyLong_FromUint32(triton::engines::solver::TIMEOUT));
+        PyDict_SetItemString(solverDict, "UNKNOWN",  PyLong_FromUint32(triton::engines::solver::UNKNOWN));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
@@ -60,7 +60,7 @@ Returns the node vector size.
 Returns the list of child nodes.
 
 - <b>integer getHash(void)</b><br>
-Returns the hash (signature) of the AST .
+Returns the structural hash (signature) of the AST. The hash is a 64-bit integer computed once when the node is built.
 
 - <b>\ref py_AST_NODE_page getKind(void)</b><br>
 Returns the kind of the node.<br>
@@ -188,7 +188,7 @@ namespace triton {
 
       static PyObject* AstNode_getHash(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyAstNode_AsAstNode(self)->hash(1));
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getHash());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -209,11 +209,10 @@ namespace triton {
       static PyObject* AstNode_getParents(PyObject* self, PyObject* noarg) {
         try {
           PyObject* ret = nullptr;
-          std::set<triton::ast::AbstractNode*>& parents = PyAstNode_AsAstNode(self)->getParents();
+          triton::ast::ParentVector& parents = PyAstNode_AsAstNode(self)->getParents();
           ret = xPyList_New(parents.size());
-          triton::uint32 index = 0;
-          for (std::set<triton::ast::AbstractNode*>::iterator it = parents.begin(); it != parents.end(); it++)
-            PyList_SetItem(ret, index++, PyAstNode(*it));
+          for (triton::uint32 index = 0; index < parents.size(); index++)
+            PyList_SetItem(ret, index, PyAstNode(parents[index]));
           return ret;
           }
         catch (const triton::exceptions::Exception& e) {
@@ -306,7 +305,7 @@ namespace triton {
 
 
       static int AstNode_cmp(AstNode_Object* a, AstNode_Object* b) {
-        return !(a->node->hash(1) == b->node->hash(1));
+        return !(a->node->equalTo(b->node));
       }
 
 
@@ -0,0 +1,279 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <string>
+#include <vector>
+
+#include <triton/astTape.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/pythonObjects.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+
+
+
+/*! \page py_AstTape_page AstTape
+    \brief [**python api**] All information about the AstTape python object.
+
+\tableofcontents
+
+\section py_AstTape_description Description
+<hr>
+
+This object is an AST compiled by compileAst() into a list of instructions. References are followed
+and the sub-trees without symbolic variable are folded into constants. The tape is then evaluated again
+and again under different values of its symbolic variables, much faster than building new nodes or
+asking Z3. It is useful to brute-force small inputs, to check candidate models or to test opaque
+predicates with random inputs.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import *
+>>> from triton.ast import *
+
+>>> setArchitecture(ARCH.X86_64)
+>>> x = newSymbolicVariable(32)
+>>> y = newSymbolicVariable(32)
+>>> node = bvadd(bvmul(variable(x), bv(3, 32)), variable(y))
+
+>>> tape = compileAst(node)
+>>> tape.getVariables()
+[0L, 1L]
+>>> tape.evaluate([1, 2])
+5L
+>>> tape.evaluate({x.getId(): 10, y.getId(): 20})
+50L
+>>> tape.evaluateBatch([[1, 2], [3, 4], {x.getId(): 10, y.getId(): 20}])
+[5L, 13L, 50L]
+~~~~~~~~~~~~~
+
+\section AstTape_py_api Python API - Methods of the AstTape class
+<hr>
+
+- <b>integer evaluate(list values)</b><br>
+Evaluates the compiled node. `values` are the values of the symbolic variables, in the order of getVariables().
+
+- <b>integer evaluate(dict values)</b><br>
+Evaluates the compiled node. `values` is a dictionary of {integer symVarId : integer value}. It must give a value to each symbolic variable.
+
+- <b>[integer, ...] evaluateBatch(list values)</b><br>
+Evaluates the compiled node once per element of `values`. Each element is a list or a dict, as given to evaluate().
+When the node and its sub-trees have 64 bits or fewer, the evaluations are run side by side with SIMD instructions.
+It is the fastest way to test a constraint against many inputs, e.g. the seeds of a fuzzer, before asking a solver.
+
+- <b>integer getBitvectorSize(void)</b><br>
+Returns the size of the compiled node.
+
+- <b>integer getNumberOfInstructions(void)</b><br>
+Returns the number of instructions run by evaluate().
+
+- <b>[integer, ...] getVariables(void)</b><br>
+Returns the ids of the symbolic variables of the compiled node, in the order of the values given to evaluate().
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! AstTape destructor.
+      void AstTape_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        delete PyAstTape_AsAstTape(self);
+        Py_DECREF(self);
+      }
+
+
+      /* Converts a list or a dict of values into the inputs of the tape */
+      static std::vector<triton::uint512> AstTape_getValues(triton::ast::AstTape* tape, PyObject* values, const std::string& method) {
+        const std::vector<triton::usize>& variables = tape->getVariables();
+        std::vector<triton::uint512> inputs;
+
+        if (PyList_Check(values)) {
+          if (static_cast<triton::usize>(PyList_Size(values)) != variables.size())
+            throw triton::exceptions::Bindings(method + ": Expects one value per symbolic variable.");
+
+          for (Py_ssize_t i = 0; i < PyList_Size(values); i++) {
+            PyObject* item = PyList_GetItem(values, i);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              throw triton::exceptions::Bindings(method + ": Each value must be an integer.");
+            inputs.push_back(PyLong_AsUint512(item));
+          }
+        }
+
+        else if (PyDict_Check(values)) {
+          for (triton::usize id : variables) {
+            PyObject* key  = PyLong_FromUsize(id);
+            PyObject* item = PyDict_GetItem(values, key);
+            Py_DECREF(key);
+
+            if (item == nullptr)
+              throw triton::exceptions::Bindings(method + ": Expects a value for each symbolic variable.");
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              throw triton::exceptions::Bindings(method + ": Each value must be an integer.");
+            inputs.push_back(PyLong_AsUint512(item));
+          }
+        }
+
+        else
+          throw triton::exceptions::Bindings(method + ": Expects a list or a dict of values.");
+
+        return inputs;
+      }
+
+
+      static PyObject* AstTape_evaluate(PyObject* self, PyObject* values) {
+        try {
+          triton::ast::AstTape* tape = PyAstTape_AsAstTape(self);
+          return PyLong_FromUint512(tape->evaluate(AstTape_getValues(tape, values, "AstTape::evaluate()")));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstTape_evaluateBatch(PyObject* self, PyObject* values) {
+        try {
+          triton::ast::AstTape* tape = PyAstTape_AsAstTape(self);
+          std::vector<std::vector<triton::uint512>> inputs;
+
+          if (!PyList_Check(values))
+            return PyErr_Format(PyExc_TypeError, "AstTape::evaluateBatch(): Expects a list as argument.");
+
+          inputs.reserve(PyList_Size(values));
+          for (Py_ssize_t i = 0; i < PyList_Size(values); i++)
+            inputs.push_back(AstTape_getValues(tape, PyList_GetItem(values, i), "AstTape::evaluateBatch()"));
+
+          std::vector<triton::uint512> results = tape->evaluateBatch(inputs);
+          PyObject* ret = xPyList_New(results.size());
+
+          for (triton::usize index = 0; index < results.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUint512(results[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstTape_getBitvectorSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyAstTape_AsAstTape(self)->getBitvectorSize());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstTape_getNumberOfInstructions(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyAstTape_AsAstTape(self)->getNumberOfInstructions());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstTape_getVariables(PyObject* self, PyObject* noarg) {
+        try {
+          const std::vector<triton::usize>& variables = PyAstTape_AsAstTape(self)->getVariables();
+          PyObject* ret = xPyList_New(variables.size());
+
+          for (triton::usize index = 0; index < variables.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUsize(variables[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      //! AstTape methods.
+      PyMethodDef AstTape_callbacks[] = {
+        {"evaluate",                AstTape_evaluate,                 METH_O,         ""},
+        {"evaluateBatch",           AstTape_evaluateBatch,            METH_O,         ""},
+        {"getBitvectorSize",        AstTape_getBitvectorSize,         METH_NOARGS,    ""},
+        {"getNumberOfInstructions", AstTape_getNumberOfInstructions,  METH_NOARGS,    ""},
+        {"getVariables",            AstTape_getVariables,             METH_NOARGS,    ""},
+        {nullptr,                   nullptr,                          0,              nullptr}
+      };
+
+
+      PyTypeObject AstTape_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "AstTape",                                  /* tp_name */
+        sizeof(AstTape_Object),                     /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)AstTape_dealloc,                /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "AstTape objects",                          /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        AstTape_callbacks,                          /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      PyObject* PyAstTape(const triton::ast::AstTape& tape) {
+        AstTape_Object* object;
+
+        PyType_Ready(&AstTape_Type);
+        object = PyObject_NEW(AstTape_Object, &AstTape_Type);
+        if (object != NULL)
+          object->tape = new triton::ast::AstTape(tape);
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
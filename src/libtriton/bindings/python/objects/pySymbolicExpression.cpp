@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <triton/api.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/pythonObjects.hpp>
 #include <triton/pythonUtils.hpp>
@@ -259,6 +260,8 @@ namespace triton {
           if (!PyAstNode_Check(node))
             return PyErr_Format(PyExc_TypeError, "SymbolicExpression::setAst(): Expected a AstNode as argument.");
           PySymbolicExpression_AsSymbolicExpression(self)->setAst(PyAstNode_AsAstNode(node));
+          /* The full ASTs which went through this expression are outdated */
+          triton::api.getSymbolicEngine()->invalidateFullAsts();
           Py_INCREF(Py_None);
         return Py_None;
         }
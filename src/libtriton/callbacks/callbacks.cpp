@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+
 #include <triton/callbacks.hpp>
 #include <triton/exceptions.hpp>
 
@@ -21,6 +23,8 @@ namespace triton {
       this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
       this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
       this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
+      this->symbolicSimplificationTable         = copy.symbolicSimplificationTable;
+      this->symbolicSimplificationAnyKind       = copy.symbolicSimplificationAnyKind;
       this->isDefined                           = copy.isDefined;
     }
 
@@ -33,6 +37,8 @@ namespace triton {
       this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
       this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
       this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
+      this->symbolicSimplificationTable         = copy.symbolicSimplificationTable;
+      this->symbolicSimplificationAnyKind       = copy.symbolicSimplificationAnyKind;
       this->isDefined                           = copy.isDefined;
     }
 
@@ -50,7 +56,14 @@ namespace triton {
 
 
     void Callbacks::addCallback(triton::callbacks::symbolicSimplificationCallback cb) {
-      this->symbolicSimplificationCallbacks.push_back(cb);
+      this->addCallback(cb, std::set<triton::ast::kind_e>());
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::symbolicSimplificationCallback cb, const std::set<triton::ast::kind_e>& kinds, triton::uint32 minSize) {
+      SymbolicSimplificationEntry entry = {cb, kinds, minSize};
+      this->symbolicSimplificationCallbacks.push_back(entry);
+      this->updateSymbolicSimplificationTable();
       this->isDefined = true;
     }
 
@@ -59,6 +72,7 @@ namespace triton {
       this->getConcreteMemoryValueCallbacks.clear();
       this->getConcreteRegisterValueCallbacks.clear();
       this->symbolicSimplificationCallbacks.clear();
+      this->updateSymbolicSimplificationTable();
     }
 
 
@@ -77,7 +91,9 @@ namespace triton {
 
 
     void Callbacks::removeCallback(triton::callbacks::symbolicSimplificationCallback cb) {
-      this->symbolicSimplificationCallbacks.remove(cb);
+      auto& entries = this->symbolicSimplificationCallbacks;
+      entries.erase(std::remove_if(entries.begin(), entries.end(), [&cb](const SymbolicSimplificationEntry& entry) { return entry.callback == cb; }), entries.end());
+      this->updateSymbolicSimplificationTable();
       if (this->countCallbacks() == 0)
         this->isDefined = false;
     }
@@ -87,10 +103,26 @@ namespace triton {
       // FIXME : Most of callback node are ignored. May be we should return a list of nodes?
       switch (kind) {
         case triton::callbacks::SYMBOLIC_SIMPLIFICATION: {
-          for (auto& function: this->symbolicSimplificationCallbacks) {
-            node = function(node);
+          /*
+           * The callbacks are called in the order they were added. As a callback may return
+           * a node of another kind, the next one is looked up from the kind of the current node.
+           */
+          triton::usize next = 0;
+          while (true) {
+            auto it = this->symbolicSimplificationTable.find(node->getKind());
+            const std::vector<triton::usize>& indexes = (it != this->symbolicSimplificationTable.end()) ? it->second : this->symbolicSimplificationAnyKind;
+
+            auto index = std::lower_bound(indexes.begin(), indexes.end(), next);
+            while (index != indexes.end() && node->getBitvectorSize() < this->symbolicSimplificationCallbacks[*index].minSize)
+              index++;
+
+            if (index == indexes.end())
+              break;
+
+            node = this->symbolicSimplificationCallbacks[*index].callback(node);
             if (node == nullptr)
               throw triton::exceptions::Callbacks("Callbacks::processCallbacks(SYMBOLIC_SIMPLIFICATION): You cannot return a nullptr node.");
+            next = *index + 1;
           }
           break;
         }
@@ -134,6 +166,30 @@ namespace triton {
     }
 
 
+    void Callbacks::updateSymbolicSimplificationTable(void) {
+      this->symbolicSimplificationTable.clear();
+      this->symbolicSimplificationAnyKind.clear();
+
+      /* Each kind named by a callback gets its own list */
+      for (const SymbolicSimplificationEntry& entry : this->symbolicSimplificationCallbacks) {
+        for (triton::ast::kind_e kind : entry.kinds)
+          this->symbolicSimplificationTable[kind];
+      }
+
+      for (triton::usize index = 0; index < this->symbolicSimplificationCallbacks.size(); index++) {
+        const SymbolicSimplificationEntry& entry = this->symbolicSimplificationCallbacks[index];
+
+        if (entry.kinds.empty())
+          this->symbolicSimplificationAnyKind.push_back(index);
+
+        for (auto it = this->symbolicSimplificationTable.begin(); it != this->symbolicSimplificationTable.end(); it++) {
+          if (entry.kinds.empty() || entry.kinds.find(it->first) != entry.kinds.end())
+            it->second.push_back(index);
+        }
+      }
+    }
+
+
     triton::usize Callbacks::countCallbacks(void) const {
       triton::usize count = 0;
 
@@ -0,0 +1,173 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <exception>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include <triton/solverBranches.hpp>
+#include <triton/tritonToZ3Ast.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverBranches::SolverBranches() {
+        this->timeout       = 0;
+        this->memoryLimit   = 0;
+        this->conflictLimit = 0;
+      }
+
+
+      void SolverBranches::translate(triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                     const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints,
+                                     triton::uint32 maxThreads,
+                                     triton::uint32 timeout,
+                                     triton::uint32 memoryLimit,
+                                     triton::uint32 conflictLimit) {
+        /* The translator owns the context of the expressions below, it must be released last */
+        triton::ast::TritonToZ3Ast z3Ast{symbolicEngine, false};
+        z3::expr_vector taken(z3Ast.getContext());
+        z3::expr_vector untaken(z3Ast.getContext());
+        triton::usize workers = maxThreads;
+
+        this->workers.clear();
+        this->prefixes.clear();
+        this->timeout       = timeout;
+        this->memoryLimit   = memoryLimit;
+        this->conflictLimit = conflictLimit;
+
+        /* List the untaken branches with the number of taken branches which precede them */
+        for (triton::usize index = 0; index < pathConstraints.size(); index++) {
+          if (!pathConstraints[index].isMultipleBranches())
+            continue;
+          for (auto& branch : pathConstraints[index].getBranchConstraints()) {
+            if (std::get<0>(branch) == false) {
+              for (triton::usize i = taken.size(); i < index; i++)
+                taken.push_back(z3Ast.eval(*pathConstraints[i].getTakenPathConstraintAst()).getExpr());
+              untaken.push_back(z3Ast.eval(*std::get<3>(branch)).getExpr());
+              this->prefixes.push_back(index);
+            }
+          }
+        }
+
+        if (workers == 0)
+          workers = std::thread::hardware_concurrency();
+        if (workers > this->prefixes.size())
+          workers = this->prefixes.size();
+        if (workers == 0)
+          workers = 1;
+
+        /*
+         * Branches are striped over the workers so that each one gets early and
+         * late (harder) branches. A worker gets the taken branches which precede
+         * its last branch, all of them copied into its context at once.
+         */
+        for (triton::usize worker = 0; worker < workers; worker++) {
+          z3::expr_vector exprs(z3Ast.getContext());
+
+          this->workers.emplace_back();
+          Worker& w = this->workers.back();
+
+          for (triton::usize index = worker; index < this->prefixes.size(); index += workers)
+            w.branches.push_back(index);
+
+          w.taken = w.branches.empty() ? 0 : this->prefixes[w.branches.back()];
+          for (triton::usize i = 0; i < w.taken; i++)
+            exprs.push_back(taken[i]);
+          for (triton::usize index : w.branches)
+            exprs.push_back(untaken[index]);
+
+          w.exprs = z3::expr_vector(w.context, exprs);
+        }
+      }
+
+
+      void SolverBranches::solveWorker(Worker& worker, std::vector<std::map<triton::uint32, SolverModel>>& models) const {
+        z3::solver solver(worker.context);
+        z3::params params(worker.context);
+        triton::usize asserted = 0;
+
+        if (this->timeout)
+          params.set("timeout", static_cast<unsigned>(this->timeout));
+
+        if (this->memoryLimit)
+          params.set("max_memory", static_cast<unsigned>(this->memoryLimit));
+
+        if (this->conflictLimit)
+          params.set("max_conflicts", static_cast<unsigned>(this->conflictLimit));
+
+        solver.set(params);
+
+        for (triton::usize i = 0; i < worker.branches.size(); i++) {
+          triton::usize index = worker.branches[i];
+
+          /* Assert the taken branches which precede this one */
+          for (; asserted < this->prefixes[index]; asserted++)
+            solver.add(worker.exprs[asserted]);
+
+          solver.push();
+          solver.add(worker.exprs[worker.taken + i]);
+
+          if (solver.check() == z3::sat) {
+            z3::model m = solver.get_model();
+            for (triton::uint32 j = 0; j < m.size(); j++) {
+              z3::func_decl z3Variable = m[j];
+              z3::expr exp = m.get_const_interp(z3Variable);
+
+              if (!exp.get_sort().is_bv())
+                continue;
+
+              SolverModel trionModel = SolverModel(z3Variable.name().str(), triton::uint512(Z3_get_numeral_string(exp.ctx(), exp)));
+              models[index][trionModel.getId()] = trionModel;
+            }
+          }
+
+          solver.pop();
+        }
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverBranches::solve(void) {
+        std::vector<std::map<triton::uint32, SolverModel>> models;
+        std::vector<std::exception_ptr> errors;
+        std::vector<std::thread> threads;
+
+        models.resize(this->prefixes.size());
+        errors.resize(this->workers.size());
+
+        triton::usize index = 0;
+        for (Worker& worker : this->workers) {
+          Worker* w = &worker;
+          threads.push_back(std::thread([&, w, index]() {
+            try {
+              this->solveWorker(*w, models);
+            }
+            catch (...) {
+              errors[index] = std::current_exception();
+            }
+          }));
+          index++;
+        }
+
+        for (std::thread& thread : threads)
+          thread.join();
+
+        for (std::exception_ptr& error : errors) {
+          if (error)
+            std::rethrow_exception(error);
+        }
+
+        return std::list<std::map<triton::uint32, SolverModel>>(models.begin(), models.end());
+      }
+
+    }; /* solver namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,281 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <functional>
+#include <iterator>
+
+#include <triton/astWalker.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Appends the bytes of an integer to a key */
+      static inline void appendInteger(std::string& key, triton::uint64 value) {
+        key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+      }
+
+
+      /* Appends a string to a key, prefixed by its length */
+      static inline void appendString(std::string& key, const std::string& str) {
+        appendInteger(key, str.size());
+        key.append(str);
+      }
+
+
+      SolverCache::SolverCache(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::SolverCache("SolverCache::SolverCache(): The symbolicEngine API cannot be null.");
+
+        this->symbolicEngine = symbolicEngine;
+        this->bytes          = 0;
+        this->maxBytes       = SOLVER_CACHE_MAX_BYTES;
+        this->evicted        = 0;
+        this->hits           = 0;
+        this->misses         = 0;
+        this->reused         = 0;
+      }
+
+
+      SolverCache::~SolverCache() {
+      }
+
+
+      std::string SolverCache::getKey(triton::ast::AbstractNode* node) const {
+        /* The index of each visited node, and the index of each distinct sub-tree */
+        std::map<triton::ast::AbstractNode*, triton::uint64> indexes;
+        std::unordered_map<std::string, triton::uint64> forms;
+        std::string key;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverCache("SolverCache::getKey(): node cannot be null.");
+
+        /* The successors are serialized before their parents with an explicit stack, so that deep trees do not overflow the call stack */
+        triton::ast::postOrderWalk(node,
+          [this, &indexes](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+            if (indexes.find(node) != indexes.end())
+              return false;
+
+            /* A reference is the expression it points to */
+            if (node->getKind() == triton::ast::REFERENCE_NODE) {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+              triton::engines::symbolic::SymbolicExpression* expr = this->symbolicEngine->getSymbolicExpressionFromId(id);
+              if (expr == nullptr)
+                throw triton::exceptions::SolverCache("SolverCache::getKey(): Reference node not found.");
+              successors.push_back(expr->getAst());
+              return true;
+            }
+
+            for (triton::ast::AbstractNode* child : node->getChilds())
+              successors.push_back(child);
+            return true;
+          },
+          [this, &indexes, &forms, &key](triton::ast::AbstractNode* node) {
+            std::string form;
+
+            appendInteger(form, node->getKind());
+            appendInteger(form, node->getBitvectorSize());
+
+            switch (node->getKind()) {
+              case triton::ast::REFERENCE_NODE: {
+                triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+                indexes[node] = indexes[this->symbolicEngine->getSymbolicExpressionFromId(id)->getAst()];
+                return;
+              }
+
+              case triton::ast::DECIMAL_NODE: {
+                triton::uint512 value = reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue();
+                for (triton::uint32 i = 0; i < 8; i++) {
+                  appendInteger(form, triton::uint512(value & 0xffffffffffffffffULL).convert_to<triton::uint64>());
+                  value >>= 64;
+                }
+                break;
+              }
+
+              case triton::ast::VARIABLE_NODE:
+                appendString(form, reinterpret_cast<triton::ast::VariableNode*>(node)->getValue());
+                break;
+
+              case triton::ast::STRING_NODE:
+                appendString(form, reinterpret_cast<triton::ast::StringNode*>(node)->getValue());
+                break;
+
+              default:
+                appendInteger(form, node->getChilds().size());
+                for (triton::ast::AbstractNode* child : node->getChilds())
+                  appendInteger(form, indexes[child]);
+                break;
+            }
+
+            /* A sub-tree already serialized is not appended again */
+            auto it = forms.find(form);
+            if (it == forms.end()) {
+              it = forms.insert(std::make_pair(form, forms.size())).first;
+              appendString(key, form);
+            }
+            indexes[node] = it->second;
+          });
+
+        /* The root is not always the last sub-tree serialized (e.g. a reference) */
+        appendInteger(key, indexes[node]);
+
+        return key;
+      }
+
+
+      std::list<SolverCache::Item>::iterator SolverCache::lookup(const std::string& key) {
+        auto range = this->index.equal_range(std::hash<std::string>()(key));
+
+        for (auto it = range.first; it != range.second; it++) {
+          if (it->second->key == key)
+            return it->second;
+        }
+
+        return this->items.end();
+      }
+
+
+      void SolverCache::evict(void) {
+        while (this->maxBytes != 0 && this->bytes > this->maxBytes) {
+          std::list<Item>::iterator last = std::prev(this->items.end());
+          auto range = this->index.equal_range(std::hash<std::string>()(last->key));
+
+          for (auto it = range.first; it != range.second; it++) {
+            if (it->second == last) {
+              this->index.erase(it);
+              break;
+            }
+          }
+
+          this->bytes -= last->bytes;
+          this->items.erase(last);
+          this->evicted++;
+        }
+      }
+
+
+      bool SolverCache::find(const std::string& key, triton::uint32 timeout, Entry& entry) {
+        std::list<Item>::iterator it = this->lookup(key);
+
+        /* A query which timed out may succeed with more time */
+        if (it == this->items.end() || (it->entry.status == TIMEOUT && (timeout == 0 || timeout > it->entry.timeout))) {
+          this->misses++;
+          return false;
+        }
+
+        /* The entry is now the most recently used */
+        this->items.splice(this->items.begin(), this->items, it);
+
+        this->hits++;
+        entry = it->entry;
+        return true;
+      }
+
+
+      bool SolverCache::reuse(const z3::expr& expr, std::map<triton::uint32, SolverModel>& model) {
+        z3::context& ctx = expr.ctx();
+
+        for (const std::map<triton::uint32, SolverModel>& candidate : this->lastModels) {
+          z3::expr_vector src(ctx);
+          z3::expr_vector dst(ctx);
+
+          for (const auto& item : candidate) {
+            triton::engines::symbolic::SymbolicVariable* symVar = this->symbolicEngine->getSymbolicVariableFromId(item.first);
+            if (symVar == nullptr)
+              continue;
+            std::string value = item.second.getValue().str();
+            src.push_back(ctx.bv_const(symVar->getName().c_str(), symVar->getSize()));
+            dst.push_back(ctx.bv_val(value.c_str(), symVar->getSize()));
+          }
+
+          /* The model must assign every free variable of the query */
+          z3::expr result = z3::expr(expr).substitute(src, dst).simplify();
+          if (Z3_get_bool_value(ctx, result) != Z3_L_TRUE)
+            continue;
+
+          this->reused++;
+          model = candidate;
+          return true;
+        }
+
+        return false;
+      }
+
+
+      void SolverCache::record(const std::string& key, triton::engines::solver::status_e status, const std::map<triton::uint32, SolverModel>& model, triton::uint32 timeout) {
+        std::list<Item>::iterator it = this->lookup(key);
+
+        if (it == this->items.end()) {
+          this->items.push_front(Item());
+          it = this->items.begin();
+          it->key   = key;
+          it->bytes = 0;
+          this->index.insert(std::make_pair(std::hash<std::string>()(key), it));
+        }
+        else
+          this->items.splice(this->items.begin(), this->items, it);
+
+        it->entry.status  = status;
+        it->entry.model   = model;
+        it->entry.timeout = timeout;
+
+        /* The key and the model dominate the size of an item */
+        this->bytes -= it->bytes;
+        it->bytes    = sizeof(Item) + key.size() + model.size() * sizeof(std::pair<const triton::uint32, SolverModel>);
+        this->bytes += it->bytes;
+        this->evict();
+
+        if (status != SAT || model.size() == 0)
+          return;
+
+        this->lastModels.push_front(model);
+        if (this->lastModels.size() > SOLVER_CACHE_REUSED_MODELS)
+          this->lastModels.pop_back();
+      }
+
+
+      void SolverCache::clear(void) {
+        this->items.clear();
+        this->index.clear();
+        this->lastModels.clear();
+        this->bytes   = 0;
+        this->evicted = 0;
+        this->hits    = 0;
+        this->misses  = 0;
+        this->reused  = 0;
+      }
+
+
+      void SolverCache::setMaxBytes(triton::usize maxBytes) {
+        this->maxBytes = maxBytes;
+        this->evict();
+      }
+
+
+      std::map<std::string, triton::usize> SolverCache::getStats(void) const {
+        std::map<std::string, triton::usize> stats;
+
+        stats["entries"]   = this->items.size();
+        stats["bytes"]     = this->bytes;
+        stats["max_bytes"] = this->maxBytes;
+        stats["evicted"]   = this->evicted;
+        stats["hits"]      = this->hits;
+        stats["misses"]    = this->misses;
+        stats["reused"]    = this->reused;
+
+        return stats;
+      }
+
+    };
+  };
+};
@@ -5,8 +5,12 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <chrono>
+#include <new>
+#include <set>
+
 #include <triton/ast.hpp>
-#include <triton/astRepresentation.hpp>
+#include <triton/astWalker.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/solverEngine.hpp>
 #include <triton/tritonToZ3Ast.hpp>
@@ -23,7 +27,8 @@
 <hr>
 
 The solver engine is the interface between an SMT solver and **Triton** itself. All requests are sent to the SMT solver
-as Triton AST (See: \ref py_ast_page). The AST representation as string looks like a manually crafted SMT2-LIB script.
+as Triton AST (See: \ref py_ast_page). Constraints are translated in memory into Z3's AST (See: triton::ast::TritonToZ3Ast)
+without any intermediate text, but the AST representation as string still looks like a manually crafted SMT2-LIB script.
 
 <b>Example:</b>
 
@@ -55,6 +60,23 @@ as Triton AST (See: \ref py_ast_page). The AST representation as string looks li
 (assert (= (ite ...)))
 ~~~~~~~~~~~~~
 
+\section solver_interface_cache Query cache
+<hr>
+
+Results of triton::API::getModel() are cached (See: triton::engines::solver::SolverCache). A query is keyed by a canonical serialization of
+its AST where references are resolved, so asking again the same constraint returns the stored status and model without calling the solver. A
+timeout is only reused by a query with the same time limit or a lower one. On a miss, the last models found are tried against the new query before calling the solver. The
+cache is bounded by the size of its entries (64 MB by default, see triton::API::setSolverCacheLimit()) and evicts the least recently used ones. Statistics are available via
+triton::API::getSolverCacheStats().
+
+\section solver_interface_parallel Parallel branches
+<hr>
+
+triton::API::getModelsForAllBranches() solves the untaken branches of a list of path constraints on several threads. The branches are
+translated on the calling thread, then each thread gets a copy of its branches and of the taken branches which precede them in its own
+Z3 context (See: triton::engines::solver::SolverBranches). The threads never read the symbolic engine and assert incrementally the taken
+branches. Models come back in the order of the branches.
+
 \section solver_interface_examples C++ example
 <hr>
 
@@ -105,48 +127,136 @@ namespace triton {
       }
 
 
+      /* Counts the unique nodes and the variables of a Z3's AST */
+      static void countNodes(const z3::expr& root, std::set<triton::uint32>& visited, triton::usize& variables) {
+        triton::ast::postOrderWalk(root,
+          [&visited](const z3::expr& expr, std::vector<z3::expr>& successors) {
+            if (visited.insert(Z3_get_ast_id(expr.ctx(), expr)).second == false)
+              return false;
+
+            if (expr.is_app()) {
+              for (triton::uint32 i = 0; i < expr.num_args(); i++)
+                successors.push_back(expr.arg(i));
+            }
+            return true;
+          },
+          [&variables](const z3::expr& expr) {
+            if (expr.is_app() && expr.is_const() && expr.decl().decl_kind() == Z3_OP_UNINTERPRETED)
+              variables++;
+          });
+      }
+
+
+      /* Returns the microseconds elapsed since start */
+      static triton::usize elapsed(const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+      }
+
+
       SolverEngine::SolverEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
         if (symbolicEngine == nullptr)
           throw triton::exceptions::SolverEngine("SolverEngine::SolverEngine(): The symbolicEngine API cannot be null.");
         this->symbolicEngine = symbolicEngine;
+        this->timeout        = 0;
+        this->memoryLimit    = 0;
+        this->conflictLimit  = 0;
+
+        this->cache = new(std::nothrow) SolverCache(symbolicEngine);
+        if (this->cache == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::SolverEngine(): Not enough memory.");
+
+        this->translator = new(std::nothrow) triton::ast::TritonToZ3Ast(symbolicEngine, false);
+        if (this->translator == nullptr) {
+          delete this->cache;
+          throw triton::exceptions::SolverEngine("SolverEngine::SolverEngine(): Not enough memory.");
+        }
       }
 
 
       SolverEngine::~SolverEngine() {
+        delete this->translator;
+        delete this->cache;
       }
 
 
-      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const {
-        std::list<std::map<triton::uint32, SolverModel>> ret;
-        std::ostringstream formula;
-        z3::context ctx;
-        z3::solver solver(ctx);
-        triton::uint32 representationMode = triton::ast::representations::astRepresentation.getMode();
+      void SolverEngine::resetQueryStats(void) {
+        this->queryStats["status"]           = UNKNOWN;
+        this->queryStats["nodes"]            = 0;
+        this->queryStats["variables"]        = 0;
+        this->queryStats["translation_time"] = 0;
+        this->queryStats["solving_time"]     = 0;
+      }
 
-        if (node == nullptr)
-          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
 
-        /* Switch into the SMT mode */
-        triton::ast::representations::astRepresentation.setMode(triton::ast::representations::SMT_REPRESENTATION);
+      z3::params SolverEngine::getParams(z3::context& ctx, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit) const {
+        z3::params params(ctx);
+
+        timeout       = timeout       ? timeout       : this->timeout;
+        memoryLimit   = memoryLimit   ? memoryLimit   : this->memoryLimit;
+        conflictLimit = conflictLimit ? conflictLimit : this->conflictLimit;
+
+        if (timeout)
+          params.set("timeout", static_cast<unsigned>(timeout));
+
+        if (memoryLimit)
+          params.set("max_memory", static_cast<unsigned>(memoryLimit));
 
-        /* First, set the QF_AUFBV flag  */
-        formula << "(set-logic QF_BV)";
+        if (conflictLimit)
+          params.set("max_conflicts", static_cast<unsigned>(conflictLimit));
 
-        /* Then, delcare all symbolic variables */
-        formula << this->symbolicEngine->getVariablesDeclaration();
+        return params;
+      }
+
+
+      z3::expr SolverEngine::translate(triton::ast::TritonToZ3Ast& z3Ast, triton::ast::AbstractNode* node) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::set<triton::uint32> visited;
+        triton::usize variables = 0;
 
-        /* And concat the user expression */
-        formula << this->symbolicEngine->getFullAst(node);
+        /* Nodes may have been freed since the last query and their addresses given again */
+        z3Ast.clearCache();
 
-        /* Create the context and AST */
-        Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.str().c_str(), 0, 0, 0, 0, 0, 0);
-        z3::expr eq(ctx, ast);
+        /*
+         * Translate the Triton's AST directly into a Z3's AST. References are
+         * resolved by the translator itself, so there is no need to unroll the
+         * expression nor to print and parse an SMT2-LIB script.
+         */
+        z3::expr expr = z3Ast.eval(*node).getExpr();
+        this->queryStats["translation_time"] = elapsed(start);
+
+        countNodes(expr, visited, variables);
+        this->queryStats["nodes"]     = visited.size();
+        this->queryStats["variables"] = variables;
+
+        return expr;
+      }
 
-        /* Create a solver and add the expression */
-        solver.add(eq);
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::solve(const z3::expr& expr, triton::uint32 limit, const z3::params& params) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+
+        /* The solver must share the context of the translated expression */
+        z3::context& ctx = expr.ctx();
+        z3::solver solver(ctx);
+        solver.set(params);
+
+        /* Add the expression */
+        solver.add(expr);
+
+        /* The status of the query is the one of the first check */
+        z3::check_result result = solver.check();
+        if (result == z3::sat)
+          this->queryStats["status"] = SAT;
+        else if (result == z3::unsat)
+          this->queryStats["status"] = UNSAT;
+        else if (solver.reason_unknown().find("timeout") != std::string::npos || solver.reason_unknown().find("canceled") != std::string::npos)
+          this->queryStats["status"] = TIMEOUT;
+        else
+          this->queryStats["status"] = UNKNOWN;
 
         /* Check if it is sat */
-        while (solver.check() == z3::sat && limit >= 1) {
+        while (result == z3::sat && limit >= 1) {
 
           /* Get model */
           z3::model m = solver.get_model();
@@ -195,26 +305,131 @@ namespace triton {
 
           /* Decrement the limit */
           limit--;
-        }
 
-        /* Restore the representation mode */
-        triton::ast::representations::astRepresentation.setMode(representationMode);
+          /* Look for the next model */
+          if (limit >= 1)
+            result = solver.check();
+        }
 
+        this->queryStats["solving_time"] = elapsed(start);
         return ret;
       }
 
 
-      std::map<triton::uint32, SolverModel> SolverEngine::getModel(triton::ast::AbstractNode* node) const {
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModelsForAllBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 maxThreads) const {
+        SolverBranches branches;
+
+        this->translateBranches(pathConstraints, maxThreads, branches);
+        return branches.solve();
+      }
+
+
+      void SolverEngine::translateBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 maxThreads, SolverBranches& branches) const {
+        branches.translate(this->symbolicEngine, pathConstraints, maxThreads, this->timeout, this->memoryLimit, this->conflictLimit);
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) {
+        return this->getModels(node, limit, 0, 0, 0);
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
+
+        this->resetQueryStats();
+
+        z3::expr expr = this->translate(*this->translator, node);
+
+        if (!expr.is_bool())
+          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node must be a logical constraint.");
+
+        return this->solve(expr, limit, this->getParams(expr.ctx(), timeout, memoryLimit, conflictLimit));
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverEngine::getModel(triton::ast::AbstractNode* node) {
+        return this->getModel(node, 0, 0, 0);
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverEngine::getModel(triton::ast::AbstractNode* node, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit) {
         std::map<triton::uint32, SolverModel> ret;
         std::list<std::map<triton::uint32, SolverModel>> allModels;
+        SolverCache::Entry entry;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getModel(): node cannot be null.");
+
+        this->resetQueryStats();
+
+        /* Same query already solved (sat, unsat or timeout) */
+        std::string key = this->cache->getKey(node);
+        timeout = timeout ? timeout : this->timeout;
+        if (this->cache->find(key, timeout, entry)) {
+          this->queryStats["status"] = entry.status;
+          return entry.model;
+        }
 
-        allModels = this->getModels(node, 1);
+        z3::expr expr = this->translate(*this->translator, node);
+
+        if (!expr.is_bool())
+          throw triton::exceptions::SolverEngine("SolverEngine::getModel(): node must be a logical constraint.");
+
+        /* Try the last models found before calling the solver */
+        if (this->cache->reuse(expr, ret) == true) {
+          this->queryStats["status"] = SAT;
+          this->cache->record(key, SAT, ret, 0);
+          return ret;
+        }
+
+        allModels = this->solve(expr, 1, this->getParams(expr.ctx(), timeout, memoryLimit, conflictLimit));
         if (allModels.size() > 0)
           ret = allModels.front();
 
+        /* A query which gave up on another limit may succeed later with other limits */
+        if (this->queryStats["status"] != UNKNOWN)
+          this->cache->record(key, static_cast<status_e>(this->queryStats["status"]), ret, timeout);
+
         return ret;
       }
 
+
+      void SolverEngine::setTimeout(triton::uint32 timeout) {
+        this->timeout = timeout;
+      }
+
+
+      void SolverEngine::setMemoryLimit(triton::uint32 memoryLimit) {
+        this->memoryLimit = memoryLimit;
+      }
+
+
+      void SolverEngine::setConflictLimit(triton::uint32 conflictLimit) {
+        this->conflictLimit = conflictLimit;
+      }
+
+
+      const std::map<std::string, triton::usize>& SolverEngine::getQueryStats(void) const {
+        return this->queryStats;
+      }
+
+
+      std::map<std::string, triton::usize> SolverEngine::getCacheStats(void) const {
+        return this->cache->getStats();
+      }
+
+
+      void SolverEngine::clearCache(void) {
+        this->cache->clear();
+      }
+
+
+      void SolverEngine::setCacheLimit(triton::usize maxBytes) {
+        this->cache->setMaxBytes(maxBytes);
+      }
+
     };
   };
 };
@@ -0,0 +1,321 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstdlib>
+#include <new>
+#include <tuple>
+
+#include <triton/astWalker.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/solverSession.hpp>
+#include <triton/symbolicEnums.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverSession::SolverSession(triton::modes::Modes* modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+        if (modes == nullptr)
+          throw triton::exceptions::SolverSession("SolverSession::SolverSession(): The modes API cannot be null.");
+
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::SolverSession("SolverSession::SolverSession(): The symbolicEngine API cannot be null.");
+
+        this->modes                     = modes;
+        this->symbolicEngine            = symbolicEngine;
+        this->translator                = nullptr;
+        this->solver                    = nullptr;
+        this->numberOfConstraints       = 0;
+        this->numberOfSlicedConstraints = 0;
+        this->lastGeneration            = 0;
+        this->freedNodes                = triton::ast::AbstractNode::getFreedNodes();
+        this->astGeneration             = triton::ast::AbstractNode::getGeneration();
+        this->init();
+      }
+
+
+      SolverSession::~SolverSession() {
+        this->release();
+      }
+
+
+      void SolverSession::init(void) {
+        this->translator = new(std::nothrow) triton::ast::TritonToZ3Ast(this->symbolicEngine, false);
+        if (this->translator == nullptr)
+          throw triton::exceptions::SolverSession("SolverSession::init(): Not enough memory.");
+
+        this->solver = new(std::nothrow) z3::solver(this->translator->getContext());
+        if (this->solver == nullptr)
+          throw triton::exceptions::SolverSession("SolverSession::init(): Not enough memory.");
+      }
+
+
+      void SolverSession::release(void) {
+        /* The solver must be released before the context owned by the translator */
+        delete this->solver;
+        delete this->translator;
+        this->solver     = nullptr;
+        this->translator = nullptr;
+      }
+
+
+      void SolverSession::reset(void) {
+        /*
+         * Recreate the translator too. Its cache is keyed by node identity
+         * and must not outlive the AST nodes of the previous trace.
+         */
+        this->release();
+        this->init();
+        this->numberOfConstraints       = 0;
+        this->numberOfSlicedConstraints = 0;
+        this->lastGeneration            = 0;
+        this->freedNodes                = triton::ast::AbstractNode::getFreedNodes();
+        this->astGeneration             = triton::ast::AbstractNode::getGeneration();
+        this->branchModels.clear();
+        this->partitions.clear();
+        this->slicedConstraints.clear();
+        this->partitionModels.clear();
+      }
+
+
+      bool SolverSession::check(z3::solver& solver, std::map<triton::uint32, SolverModel>& model) const {
+        if (solver.check() != z3::sat)
+          return false;
+
+        z3::model m = solver.get_model();
+        for (triton::uint32 i = 0; i < m.size(); i++) {
+          z3::func_decl z3Variable = m[i];
+          z3::expr exp = m.get_const_interp(z3Variable);
+
+          if (!exp.get_sort().is_bv())
+            continue;
+
+          SolverModel trionModel = SolverModel(z3Variable.name().str(), triton::uint512(Z3_get_numeral_string(exp.ctx(), exp)));
+          model[trionModel.getId()] = trionModel;
+        }
+
+        return true;
+      }
+
+
+      void SolverSession::collectVariables(triton::ast::AbstractNode* node, std::set<triton::usize>& variables, std::set<triton::ast::AbstractNode*>& visited) const {
+        triton::ast::preOrderWalk(node, [this, &variables, &visited](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+          if (!visited.insert(node).second)
+            return false;
+
+          switch (node->getKind()) {
+            case triton::ast::REFERENCE_NODE: {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+              successors.push_back(this->symbolicEngine->getSymbolicExpressionFromId(id)->getAst());
+              break;
+            }
+
+            /* Same id as the one of the SolverModel */
+            case triton::ast::VARIABLE_NODE:
+              variables.insert(std::atoi(reinterpret_cast<triton::ast::VariableNode*>(node)->getValue().c_str() + TRITON_SYMVAR_NAME_SIZE));
+              break;
+
+            default:
+              for (triton::ast::AbstractNode* child : node->getChilds())
+                successors.push_back(child);
+              break;
+          }
+
+          return true;
+        });
+      }
+
+
+      triton::usize SolverSession::findPartition(triton::usize variable) {
+        std::map<triton::usize, triton::usize>::iterator it = this->partitions.find(variable);
+        triton::usize root = variable;
+
+        if (it == this->partitions.end()) {
+          this->partitions[variable] = variable;
+          return variable;
+        }
+
+        while (this->partitions[root] != root)
+          root = this->partitions[root];
+
+        /* Path compression */
+        while (this->partitions[variable] != root) {
+          triton::usize next = this->partitions[variable];
+          this->partitions[variable] = root;
+          variable = next;
+        }
+
+        return root;
+      }
+
+
+      void SolverSession::slice(triton::usize index) {
+        const std::vector<triton::engines::symbolic::PathConstraint>& pco = this->symbolicEngine->getPathConstraints();
+
+        for (; this->numberOfSlicedConstraints < index; this->numberOfSlicedConstraints++) {
+          triton::ast::AbstractNode* pc = pco[this->numberOfSlicedConstraints].getTakenPathConstraintAst();
+          std::set<triton::ast::AbstractNode*> visited;
+          std::set<triton::usize> variables;
+
+          /* A constraint without variable always holds on the trace */
+          this->collectVariables(pc, variables, visited);
+          if (variables.empty())
+            continue;
+
+          /* Merge the partitions of its variables. Their models are no longer valid. */
+          triton::usize root = this->findPartition(*variables.begin());
+          this->partitionModels.erase(root);
+          for (triton::usize variable : variables) {
+            triton::usize other = this->findPartition(variable);
+            if (other == root)
+              continue;
+            this->partitionModels.erase(other);
+            this->partitions[other] = root;
+          }
+
+          this->slicedConstraints.push_back(std::make_pair(root, pc));
+        }
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverSession::checkSliced(triton::ast::AbstractNode* node) {
+        std::map<triton::usize, std::vector<triton::ast::AbstractNode*>> others;
+        std::map<triton::uint32, SolverModel> ret;
+        std::set<triton::ast::AbstractNode*> visited;
+        std::set<triton::usize> variables;
+        std::set<triton::usize> roots;
+
+        this->collectVariables(node, variables, visited);
+        for (triton::usize variable : variables)
+          roots.insert(this->findPartition(variable));
+
+        /* Only the partitions which share variables with the node go to the solver */
+        z3::solver solver(this->translator->getContext());
+        solver.add(this->translator->eval(*node).getExpr());
+        for (auto& item : this->slicedConstraints) {
+          triton::usize root = this->findPartition(item.first);
+          if (roots.find(root) != roots.end())
+            solver.add(this->translator->eval(*item.second).getExpr());
+          else
+            others[root].push_back(item.second);
+        }
+
+        if (this->check(solver, ret) == false)
+          return ret;
+
+        /* The other partitions are independent, complete the model with theirs */
+        for (auto& item : others) {
+          if (this->partitionModels.find(item.first) == this->partitionModels.end()) {
+            z3::solver partition(this->translator->getContext());
+            for (triton::ast::AbstractNode* pc : item.second)
+              partition.add(this->translator->eval(*pc).getExpr());
+            this->check(partition, this->partitionModels[item.first]);
+          }
+          ret.insert(this->partitionModels[item.first].begin(), this->partitionModels[item.first].end());
+        }
+
+        return ret;
+      }
+
+
+      void SolverSession::update(void) {
+        const std::vector<triton::engines::symbolic::PathConstraint>& pco = this->symbolicEngine->getPathConstraints();
+
+        /*
+         * Path constraints have been cleared or rewound (e.g. by the restore of a backup of the
+         * symbolic engine) since the last update, start a new session. They may have grown again
+         * since, so the generation of the last asserted one is compared too.
+         */
+        if (pco.size() < this->numberOfConstraints ||
+            (this->numberOfConstraints != 0 && this->symbolicEngine->getPathConstraintGeneration(this->numberOfConstraints - 1) != this->lastGeneration))
+          this->reset();
+
+        /*
+         * The cache of the translator is keyed by node address. Freed addresses are given again, and
+         * a node in use changes its meaning when one of its childs or the AST of an expression it
+         * references is replaced (See: triton::ast::AbstractNode::getGeneration()).
+         */
+        if (triton::ast::AbstractNode::getFreedNodes() != this->freedNodes ||
+            triton::ast::AbstractNode::getGeneration() != this->astGeneration) {
+          this->translator->clearCache();
+          this->freedNodes    = triton::ast::AbstractNode::getFreedNodes();
+          this->astGeneration = triton::ast::AbstractNode::getGeneration();
+        }
+
+        for (triton::usize index = this->numberOfConstraints; index < pco.size(); index++) {
+          const triton::engines::symbolic::PathConstraint& pc = pco[index];
+
+          /* Solve untaken branches on top of the previous constraints */
+          if (pc.isMultipleBranches()) {
+            for (auto& branch : pc.getBranchConstraints()) {
+              std::map<triton::uint32, SolverModel> model;
+              if (std::get<0>(branch) == true)
+                continue;
+              if (this->modes->isModeEnabled(triton::modes::PC_SLICING)) {
+                this->slice(index);
+                this->branchModels.push_back(this->checkSliced(std::get<3>(branch)));
+                continue;
+              }
+              z3::expr expr = this->translator->eval(*std::get<3>(branch)).getExpr();
+              this->solver->push();
+              this->solver->add(expr);
+              this->check(*this->solver, model);
+              this->branchModels.push_back(model);
+              this->solver->pop();
+            }
+          }
+
+          /* Then, keep the taken branch for the next constraints */
+          this->solver->add(this->translator->eval(*pc.getTakenPathConstraintAst()).getExpr());
+          this->lastGeneration = this->symbolicEngine->getPathConstraintGeneration(index);
+          this->numberOfConstraints++;
+        }
+      }
+
+
+      triton::usize SolverSession::getNumberOfConstraints(void) const {
+        return this->numberOfConstraints;
+      }
+
+
+      const std::list<std::map<triton::uint32, SolverModel>>& SolverSession::getModelsForUntakenBranches(void) {
+        this->update();
+        return this->branchModels;
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverSession::getModel(triton::ast::AbstractNode* node) {
+        std::map<triton::uint32, SolverModel> ret;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverSession("SolverSession::getModel(): node cannot be null.");
+
+        this->update();
+
+        z3::expr expr = this->translator->eval(*node).getExpr();
+        if (!expr.is_bool())
+          throw triton::exceptions::SolverSession("SolverSession::getModel(): node must be a logical constraint.");
+
+        if (this->modes->isModeEnabled(triton::modes::PC_SLICING)) {
+          this->slice(this->numberOfConstraints);
+          return this->checkSliced(node);
+        }
+
+        this->solver->push();
+        this->solver->add(expr);
+        this->check(*this->solver, ret);
+        this->solver->pop();
+
+        return ret;
+      }
+
+    };
+  };
+};
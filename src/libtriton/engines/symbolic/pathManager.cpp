@@ -15,6 +15,9 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      triton::usize PathManager::lastGeneration = 0;
+
+
       PathManager::PathManager(triton::modes::Modes* modes) {
         if (modes == nullptr)
           throw triton::exceptions::PathManager("PathManager::PathManager(): The modes API cannot be null.");
@@ -34,6 +37,7 @@ namespace triton {
       void PathManager::copy(const PathManager& other) {
         this->modes           = other.modes;
         this->pathConstraints = other.pathConstraints;
+        this->generations     = other.generations;
       }
 
 
@@ -68,6 +72,13 @@ namespace triton {
       }
 
 
+      triton::usize PathManager::getPathConstraintGeneration(triton::usize index) const {
+        if (index >= this->generations.size())
+          throw triton::exceptions::PathManager("PathManager::getPathConstraintGeneration(): Invalid index.");
+        return this->generations[index];
+      }
+
+
       /* Add a path constraint */
       void PathManager::addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr) {
         triton::engines::symbolic::PathConstraint pco;
@@ -114,12 +125,14 @@ namespace triton {
           pco.addBranchConstraint(bb2 == dstAddr, srcAddr, bb2, bb2pc);
 
           this->pathConstraints.push_back(pco);
+          this->generations.push_back(++PathManager::lastGeneration);
         }
 
         /* Direct branch */
         else {
           pco.addBranchConstraint(true, srcAddr, dstAddr, triton::ast::equal(pc, triton::ast::bv(dstAddr, size)));
           this->pathConstraints.push_back(pco);
+          this->generations.push_back(++PathManager::lastGeneration);
         }
 
       }
@@ -127,6 +140,7 @@ namespace triton {
 
       void PathManager::clearPathConstraints(void) {
         this->pathConstraints.clear();
+        this->generations.clear();
       }
 
 
@@ -0,0 +1,403 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cctype>
+#include <set>
+#include <stdexcept>
+
+#include <triton/exceptions.hpp>
+#include <triton/simplificationRule.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* The operators of the rules */
+      static const struct {
+        const char* name;
+        triton::ast::kind_e kind;
+        triton::uint32 arity;
+      } operators[] = {
+        {"bvadd",    triton::ast::BVADD_NODE,    2},
+        {"bvand",    triton::ast::BVAND_NODE,    2},
+        {"bvashr",   triton::ast::BVASHR_NODE,   2},
+        {"bvlshr",   triton::ast::BVLSHR_NODE,   2},
+        {"bvmul",    triton::ast::BVMUL_NODE,    2},
+        {"bvnand",   triton::ast::BVNAND_NODE,   2},
+        {"bvneg",    triton::ast::BVNEG_NODE,    1},
+        {"bvnor",    triton::ast::BVNOR_NODE,    2},
+        {"bvnot",    triton::ast::BVNOT_NODE,    1},
+        {"bvor",     triton::ast::BVOR_NODE,     2},
+        {"bvsdiv",   triton::ast::BVSDIV_NODE,   2},
+        {"bvsge",    triton::ast::BVSGE_NODE,    2},
+        {"bvsgt",    triton::ast::BVSGT_NODE,    2},
+        {"bvshl",    triton::ast::BVSHL_NODE,    2},
+        {"bvsle",    triton::ast::BVSLE_NODE,    2},
+        {"bvslt",    triton::ast::BVSLT_NODE,    2},
+        {"bvsmod",   triton::ast::BVSMOD_NODE,   2},
+        {"bvsrem",   triton::ast::BVSREM_NODE,   2},
+        {"bvsub",    triton::ast::BVSUB_NODE,    2},
+        {"bvudiv",   triton::ast::BVUDIV_NODE,   2},
+        {"bvuge",    triton::ast::BVUGE_NODE,    2},
+        {"bvugt",    triton::ast::BVUGT_NODE,    2},
+        {"bvule",    triton::ast::BVULE_NODE,    2},
+        {"bvult",    triton::ast::BVULT_NODE,    2},
+        {"bvurem",   triton::ast::BVUREM_NODE,   2},
+        {"bvxnor",   triton::ast::BVXNOR_NODE,   2},
+        {"bvxor",    triton::ast::BVXOR_NODE,    2},
+        {"distinct", triton::ast::DISTINCT_NODE, 2},
+        {"equal",    triton::ast::EQUAL_NODE,    2},
+        {"ite",      triton::ast::ITE_NODE,      3},
+        {"land",     triton::ast::LAND_NODE,     2},
+        {"lnot",     triton::ast::LNOT_NODE,     1},
+        {"lor",      triton::ast::LOR_NODE,      2},
+      };
+
+
+      /* Returns true if the two childs of the node may be swapped */
+      static bool isCommutative(triton::ast::kind_e kind) {
+        switch (kind) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* Splits a side of a rule into parentheses and words */
+      static std::vector<std::string> tokenize(const std::string& str) {
+        std::vector<std::string> tokens;
+        std::string token;
+
+        for (char c : str) {
+          if (c == '(' || c == ')' || std::isspace(static_cast<unsigned char>(c))) {
+            if (!token.empty())
+              tokens.push_back(token);
+            if (c == '(' || c == ')')
+              tokens.push_back(std::string(1, c));
+            token.clear();
+          }
+          else {
+            token += c;
+          }
+        }
+
+        if (!token.empty())
+          tokens.push_back(token);
+
+        return tokens;
+      }
+
+
+      /* Collects the names used by a term */
+      template <typename Term>
+      static void collectNames(const Term& term, std::set<std::string>& names) {
+        if (term.type == Term::NAME)
+          names.insert(term.name);
+        for (const Term& child : term.childs)
+          collectNames(child, names);
+      }
+
+
+      SimplificationRule::SimplificationRule(const std::string& rule) {
+        std::set<std::string> patternNames;
+        std::set<std::string> replacementNames;
+        std::string::size_type arrow = rule.find("->");
+
+        if (arrow == std::string::npos || rule.find("->", arrow + 2) != std::string::npos)
+          throw triton::exceptions::SymbolicSimplification("SimplificationRule::SimplificationRule(): A rule must be written as \"pattern -> replacement\".");
+
+        std::vector<std::string> left  = tokenize(rule.substr(0, arrow));
+        std::vector<std::string> right = tokenize(rule.substr(arrow + 2));
+        triton::usize index = 0;
+
+        this->rule = rule;
+
+        this->pattern = this->parse(left, index);
+        if (index != left.size())
+          throw triton::exceptions::SymbolicSimplification("SimplificationRule::SimplificationRule(): Unexpected tokens after the pattern.");
+
+        index = 0;
+        this->replacement = this->parse(right, index);
+        if (index != right.size())
+          throw triton::exceptions::SymbolicSimplification("SimplificationRule::SimplificationRule(): Unexpected tokens after the replacement.");
+
+        /* The rules are indexed by the kind of the root of their pattern */
+        if (this->pattern.type != Term::OPERATION)
+          throw triton::exceptions::SymbolicSimplification("SimplificationRule::SimplificationRule(): The pattern must be an operation.");
+
+        collectNames(this->pattern, patternNames);
+        collectNames(this->replacement, replacementNames);
+        for (const std::string& name : replacementNames) {
+          if (patternNames.find(name) == patternNames.end())
+            throw triton::exceptions::SymbolicSimplification("SimplificationRule::SimplificationRule(): The replacement uses a name which is not in the pattern.");
+        }
+      }
+
+
+      SimplificationRule::Term SimplificationRule::parse(const std::vector<std::string>& tokens, triton::usize& index) const {
+        Term term;
+
+        term.kind     = triton::ast::UNDEFINED_NODE;
+        term.negative = false;
+
+        if (index >= tokens.size())
+          throw triton::exceptions::SymbolicSimplification("SimplificationRule::parse(): Unexpected end of rule.");
+
+        const std::string& token = tokens[index++];
+
+        if (token == ")")
+          throw triton::exceptions::SymbolicSimplification("SimplificationRule::parse(): Unexpected ')'.");
+
+        /* (operator term ...) */
+        if (token == "(") {
+          triton::uint32 arity = 0;
+
+          if (index >= tokens.size())
+            throw triton::exceptions::SymbolicSimplification("SimplificationRule::parse(): Unexpected end of rule.");
+
+          for (const auto& op : operators) {
+            if (tokens[index] == op.name) {
+              term.kind = op.kind;
+              arity     = op.arity;
+            }
+          }
+
+          if (term.kind == triton::ast::UNDEFINED_NODE)
+            throw triton::exceptions::SymbolicSimplification("SimplificationRule::parse(): Unknown operator " + tokens[index] + ".");
+
+          term.type = Term::OPERATION;
+          index++;
+
+          while (index < tokens.size() && tokens[index] != ")")
+            term.childs.push_back(this->parse(tokens, index));
+
+          if (index >= tokens.size())
+            throw triton::exceptions::SymbolicSimplification("SimplificationRule::parse(): Missing ')'.");
+          index++;
+
+          if (term.childs.size() != arity)
+            throw triton::exceptions::SymbolicSimplification("SimplificationRule::parse(): Wrong number of operands.");
+
+          return term;
+        }
+
+        /* A number: 12, 0xff or -1 */
+        if (std::isdigit(static_cast<unsigned char>(token[0])) || token[0] == '-') {
+          term.type     = Term::NUMBER;
+          term.negative = (token[0] == '-');
+          try {
+            term.value = triton::uint512(term.negative ? token.substr(1) : token);
+          }
+          catch (const std::runtime_error&) {
+            throw triton::exceptions::SymbolicSimplification("SimplificationRule::parse(): Invalid number " + token + ".");
+          }
+          return term;
+        }
+
+        /* Anything else is a name */
+        term.type = Term::NAME;
+        term.name = token;
+
+        return term;
+      }
+
+
+      triton::uint512 SimplificationRule::getNumber(const Term& term, triton::uint32 size) const {
+        triton::uint512 mask = -1;
+
+        mask = mask >> (512 - size);
+        if (term.negative)
+          return ((~term.value) + 1) & mask;
+
+        return term.value & mask;
+      }
+
+
+      std::vector<SimplificationRule::Bindings> SimplificationRule::match(const Term& term, triton::ast::AbstractNode* node, const Bindings& bindings) const {
+        std::vector<Bindings> results;
+
+        switch (term.type) {
+          case Term::NAME: {
+            auto it = bindings.find(term.name);
+            if (it == bindings.end()) {
+              results.push_back(bindings);
+              results.back()[term.name] = node;
+            }
+            else if (it->second == node || it->second->equalTo(node)) {
+              results.push_back(bindings);
+            }
+            break;
+          }
+
+          case Term::NUMBER:
+            if (node->getKind() == triton::ast::BV_NODE && node->evaluate() == this->getNumber(term, node->getBitvectorSize()))
+              results.push_back(bindings);
+            break;
+
+          case Term::OPERATION: {
+            const triton::ast::ChildVector& childs = node->getChilds();
+
+            if (node->getKind() != term.kind || childs.size() != term.childs.size())
+              break;
+
+            /* Matches the childs one after the other, keeping every way to match the previous ones */
+            auto matchChilds = [this, &term, &bindings, &results](triton::ast::AbstractNode* const* nodes) {
+              std::vector<Bindings> current(1, bindings);
+
+              for (triton::uint32 index = 0; index < term.childs.size() && !current.empty(); index++) {
+                std::vector<Bindings> next;
+                for (const Bindings& partial : current) {
+                  std::vector<Bindings> found = this->match(term.childs[index], nodes[index], partial);
+                  next.insert(next.end(), found.begin(), found.end());
+                }
+                current.swap(next);
+              }
+
+              results.insert(results.end(), current.begin(), current.end());
+            };
+
+            triton::ast::AbstractNode* nodes[3] = {nullptr, nullptr, nullptr};
+            for (triton::uint32 index = 0; index < childs.size(); index++)
+              nodes[index] = childs[index];
+            matchChilds(nodes);
+
+            if (childs.size() == 2 && isCommutative(term.kind)) {
+              std::swap(nodes[0], nodes[1]);
+              matchChilds(nodes);
+            }
+            break;
+          }
+        }
+
+        return results;
+      }
+
+
+      triton::ast::AbstractNode* SimplificationRule::build(const Term& term, const Bindings& bindings, triton::uint32 size) const {
+        switch (term.type) {
+          case Term::NAME:
+            return bindings.at(term.name);
+
+          case Term::NUMBER:
+            return triton::ast::bv(this->getNumber(term, size), size);
+
+          default:
+            break;
+        }
+
+        /* The numbers take the size of their siblings. The condition of an ite is not a sibling */
+        std::vector<triton::ast::AbstractNode*> childs(term.childs.size(), nullptr);
+        triton::uint32 siblingSize = size;
+        bool sized = false;
+
+        for (triton::uint32 index = 0; index < term.childs.size(); index++) {
+          if (term.childs[index].type == Term::NUMBER)
+            continue;
+          childs[index] = this->build(term.childs[index], bindings, size);
+          if (!sized && !(term.kind == triton::ast::ITE_NODE && index == 0)) {
+            siblingSize = childs[index]->getBitvectorSize();
+            sized = true;
+          }
+        }
+
+        for (triton::uint32 index = 0; index < term.childs.size(); index++) {
+          if (childs[index] == nullptr)
+            childs[index] = this->build(term.childs[index], bindings, siblingSize);
+        }
+
+        switch (term.kind) {
+          case triton::ast::BVADD_NODE:    return triton::ast::bvadd(childs[0], childs[1]);
+          case triton::ast::BVAND_NODE:    return triton::ast::bvand(childs[0], childs[1]);
+          case triton::ast::BVASHR_NODE:   return triton::ast::bvashr(childs[0], childs[1]);
+          case triton::ast::BVLSHR_NODE:   return triton::ast::bvlshr(childs[0], childs[1]);
+          case triton::ast::BVMUL_NODE:    return triton::ast::bvmul(childs[0], childs[1]);
+          case triton::ast::BVNAND_NODE:   return triton::ast::bvnand(childs[0], childs[1]);
+          case triton::ast::BVNEG_NODE:    return triton::ast::bvneg(childs[0]);
+          case triton::ast::BVNOR_NODE:    return triton::ast::bvnor(childs[0], childs[1]);
+          case triton::ast::BVNOT_NODE:    return triton::ast::bvnot(childs[0]);
+          case triton::ast::BVOR_NODE:     return triton::ast::bvor(childs[0], childs[1]);
+          case triton::ast::BVSDIV_NODE:   return triton::ast::bvsdiv(childs[0], childs[1]);
+          case triton::ast::BVSGE_NODE:    return triton::ast::bvsge(childs[0], childs[1]);
+          case triton::ast::BVSGT_NODE:    return triton::ast::bvsgt(childs[0], childs[1]);
+          case triton::ast::BVSHL_NODE:    return triton::ast::bvshl(childs[0], childs[1]);
+          case triton::ast::BVSLE_NODE:    return triton::ast::bvsle(childs[0], childs[1]);
+          case triton::ast::BVSLT_NODE:    return triton::ast::bvslt(childs[0], childs[1]);
+          case triton::ast::BVSMOD_NODE:   return triton::ast::bvsmod(childs[0], childs[1]);
+          case triton::ast::BVSREM_NODE:   return triton::ast::bvsrem(childs[0], childs[1]);
+          case triton::ast::BVSUB_NODE:    return triton::ast::bvsub(childs[0], childs[1]);
+          case triton::ast::BVUDIV_NODE:   return triton::ast::bvudiv(childs[0], childs[1]);
+          case triton::ast::BVUGE_NODE:    return triton::ast::bvuge(childs[0], childs[1]);
+          case triton::ast::BVUGT_NODE:    return triton::ast::bvugt(childs[0], childs[1]);
+          case triton::ast::BVULE_NODE:    return triton::ast::bvule(childs[0], childs[1]);
+          case triton::ast::BVULT_NODE:    return triton::ast::bvult(childs[0], childs[1]);
+          case triton::ast::BVUREM_NODE:   return triton::ast::bvurem(childs[0], childs[1]);
+          case triton::ast::BVXNOR_NODE:   return triton::ast::bvxnor(childs[0], childs[1]);
+          case triton::ast::BVXOR_NODE:    return triton::ast::bvxor(childs[0], childs[1]);
+          case triton::ast::DISTINCT_NODE: return triton::ast::distinct(childs[0], childs[1]);
+          case triton::ast::EQUAL_NODE:    return triton::ast::equal(childs[0], childs[1]);
+          case triton::ast::ITE_NODE:      return triton::ast::ite(childs[0], childs[1], childs[2]);
+          case triton::ast::LAND_NODE:     return triton::ast::land(childs[0], childs[1]);
+          case triton::ast::LNOT_NODE:     return triton::ast::lnot(childs[0]);
+          case triton::ast::LOR_NODE:      return triton::ast::lor(childs[0], childs[1]);
+          default:
+            throw triton::exceptions::SymbolicSimplification("SimplificationRule::build(): Invalid operator.");
+        }
+      }
+
+
+      const std::string& SimplificationRule::getRule(void) const {
+        return this->rule;
+      }
+
+
+      triton::ast::kind_e SimplificationRule::getKind(void) const {
+        return this->pattern.kind;
+      }
+
+
+      triton::ast::AbstractNode* SimplificationRule::apply(triton::ast::AbstractNode* node) const {
+        triton::ast::AbstractNode* result = nullptr;
+
+        if (node->getKind() != this->pattern.kind)
+          return nullptr;
+
+        std::vector<Bindings> matches = this->match(this->pattern, node, Bindings());
+        if (matches.empty())
+          return nullptr;
+
+        /* A replacement which mixes sizes does not apply to this node */
+        try {
+          result = this->build(this->replacement, matches.front(), node->getBitvectorSize());
+        }
+        catch (const triton::exceptions::Ast&) {
+          return nullptr;
+        }
+
+        if (result->getBitvectorSize() != node->getBitvectorSize())
+          return nullptr;
+
+        return result;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
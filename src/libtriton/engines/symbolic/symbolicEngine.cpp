@@ -7,7 +7,10 @@
 
 #include <cstring>
 #include <new>
+#include <unordered_set>
 
+#include <triton/api.hpp>
+#include <triton/astWalker.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/coreUtils.hpp>
 #include <triton/symbolicEngine.hpp>
@@ -137,18 +140,21 @@ namespace triton {
         triton::engines::symbolic::SymbolicSimplification::operator=(other);
         triton::engines::symbolic::PathManager::operator=(other);
 
+        /* The full ASTs are not shared with the other engine */
+        this->invalidateFullAsts();
+
         /* Delete unused expressions */
-        std::map<triton::usize, SymbolicExpression*>::iterator it1;
+        SymbolicStorage<SymbolicExpression>::const_iterator it1;
         for (it1 = this->symbolicExpressions.begin(); it1 != this->symbolicExpressions.end(); it1++) {
-          if (other.symbolicExpressions.find(it1->first) == other.symbolicExpressions.end())
-            delete this->symbolicExpressions[it1->first];
+          if (other.symbolicExpressions.get(it1->first) == nullptr)
+            delete it1->second;
         }
 
         /* Delete unused variables */
-        std::map<triton::usize, SymbolicVariable*>::iterator it2;
+        SymbolicStorage<SymbolicVariable>::const_iterator it2;
         for (it2 = this->symbolicVariables.begin(); it2 != this->symbolicVariables.end(); it2++) {
-          if (other.symbolicVariables.find(it2->first) == other.symbolicVariables.end())
-            delete this->symbolicVariables[it2->first];
+          if (other.symbolicVariables.get(it2->first) == nullptr)
+            delete it2->second;
         }
 
         delete[] this->symbolicReg;
@@ -157,8 +163,8 @@ namespace triton {
 
 
       SymbolicEngine::~SymbolicEngine() {
-        std::map<triton::usize, SymbolicExpression*>::iterator it1 = this->symbolicExpressions.begin();
-        std::map<triton::usize, SymbolicVariable*>::iterator it2 = this->symbolicVariables.begin();
+        SymbolicStorage<SymbolicExpression>::const_iterator it1 = this->symbolicExpressions.begin();
+        SymbolicStorage<SymbolicVariable>::const_iterator it2 = this->symbolicVariables.begin();
 
         /*
          * Don't delete symbolic expressions and symbolic variables
@@ -292,38 +298,41 @@ namespace triton {
 
       /* Returns the reference memory if it's referenced otherwise returns UNSET */
       triton::usize SymbolicEngine::getSymbolicMemoryId(triton::uint64 addr) const {
-        std::map<triton::uint64, triton::usize>::const_iterator it;
-
-        if ((it = this->memoryReference.find(addr)) != this->memoryReference.end())
-          return it->second;
-
-        return triton::engines::symbolic::UNSET;
+        return this->memoryReference.get(addr);
       }
 
 
       /* Returns the symbolic variable otherwise returns nullptr */
       SymbolicVariable* SymbolicEngine::getSymbolicVariableFromId(triton::usize symVarId) const {
-        if (this->symbolicVariables.find(symVarId) == this->symbolicVariables.end())
-          return nullptr;
-        return this->symbolicVariables.at(symVarId);
+        return this->symbolicVariables.get(symVarId);
       }
 
 
       /* Returns the symbolic variable otherwise returns nullptr */
       SymbolicVariable* SymbolicEngine::getSymbolicVariableFromName(const std::string& symVarName) const {
-        std::map<triton::usize, SymbolicVariable*>::const_iterator it;
+        SymbolicVariable* symVar = nullptr;
+        triton::usize symVarId = 0;
 
-        for (it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++) {
-          if (it->second->getName() == symVarName)
-            return it->second;
+        /* Names are built from the ids (SymVar_X), so the variable is looked up by its id */
+        if (symVarName.size() <= TRITON_SYMVAR_NAME_SIZE || symVarName.compare(0, TRITON_SYMVAR_NAME_SIZE, TRITON_SYMVAR_NAME) != 0)
+          return nullptr;
+
+        for (triton::usize index = TRITON_SYMVAR_NAME_SIZE; index < symVarName.size(); index++) {
+          if (symVarName[index] < '0' || symVarName[index] > '9')
+            return nullptr;
+          symVarId = symVarId * 10 + (symVarName[index] - '0');
         }
 
-        return nullptr;
+        symVar = this->symbolicVariables.get(symVarId);
+        if (symVar == nullptr || symVar->getName() != symVarName)
+          return nullptr;
+
+        return symVar;
       }
 
 
       /* Returns all symbolic variables */
-      const std::map<triton::usize, SymbolicVariable*>& SymbolicEngine::getSymbolicVariables(void) const {
+      const SymbolicStorage<SymbolicVariable>& SymbolicEngine::getSymbolicVariables(void) const {
         return this->symbolicVariables;
       }
 
@@ -394,18 +403,31 @@ namespace triton {
         SymbolicExpression* expr = new(std::nothrow) SymbolicExpression(node, id, kind, comment);
         if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicExpression(): not enough memory");
-        this->symbolicExpressions[id] = expr;
+        this->symbolicExpressions.set(id, expr);
         return expr;
       }
 
 
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(triton::usize symExprId) {
-        std::map<triton::uint64, triton::usize>::iterator it;
+        SymbolicExpression* expr = this->symbolicExpressions.get(symExprId);
+
+        if (expr != nullptr) {
+          /* A memory expression knows the memory it is assigned to */
+          triton::arch::MemoryAccess originMemory = expr->getOriginMemory();
+          bool isMemory = (expr->getKind() == triton::engines::symbolic::MEM);
+
+          /* The expression does not reference its AST anymore */
+          expr->getAst()->decReferenceCount();
+
+          /* Forget its full AST */
+          if (this->fullAsts.find(symExprId) != this->fullAsts.end()) {
+            this->fullAsts[symExprId].second->decReferenceCount();
+            this->fullAsts.erase(symExprId);
+          }
 
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
           /* Delete and remove the pointer */
-          delete this->symbolicExpressions[symExprId];
+          delete expr;
           this->symbolicExpressions.erase(symExprId);
 
           /* Concretize the register if it exists */
@@ -416,11 +438,11 @@ namespace triton {
             }
           }
 
-          /* Concretize the memory if it exists */
-          for (it = this->memoryReference.begin(); it != memoryReference.end(); it++) {
-            if (it->second == symExprId) {
-              this->concretizeMemory(it->first);
-              return;
+          /* Concretize the memory if it exists, only the bytes of its origin may reference it */
+          if (isMemory) {
+            for (triton::uint32 index = 0; index < originMemory.getSize(); index++) {
+              if (this->memoryReference.get(originMemory.getAddress() + index) == symExprId)
+                this->concretizeMemory(originMemory.getAddress() + index);
             }
           }
         }
@@ -430,60 +452,124 @@ namespace triton {
 
       /* Gets the symbolic expression pointer from a symbolic id */
       SymbolicExpression* SymbolicEngine::getSymbolicExpressionFromId(triton::usize symExprId) const {
-        if (this->symbolicExpressions.find(symExprId) == this->symbolicExpressions.end())
+        SymbolicExpression* expr = this->symbolicExpressions.get(symExprId);
+        if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicExpressionFromId(): symbolic expression id not found");
-        return this->symbolicExpressions.at(symExprId);
+        return expr;
       }
 
 
       /* Returns all symbolic expressions */
-      const std::map<triton::usize, SymbolicExpression*>& SymbolicEngine::getSymbolicExpressions(void) const {
+      const SymbolicStorage<SymbolicExpression>& SymbolicEngine::getSymbolicExpressions(void) const {
         return this->symbolicExpressions;
       }
 
 
-      /* Returns the full symbolic expression backtracked. */
-      triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
-
-        for (triton::uint32 index = 0; index < childs.size(); index++) {
-          if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
-            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
-            triton::ast::AbstractNode* ref = this->getSymbolicExpressionFromId(id)->getAst();
-            childs[index] = ref;
-            if (processed.find(id) != processed.end())
-              continue;
-            processed.insert(id);
-          }
-          this->getFullAst(childs[index], processed);
-        }
+      /* [private method] Returns a node whose references are unrolled. The nodes without reference are shared. */
+      triton::ast::AbstractNode* SymbolicEngine::unrollAst(triton::ast::AbstractNode* root, std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& visited) {
+        triton::ast::postOrderWalk(root,
+          [this, &visited](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+            /* A subtree shared by several nodes is unrolled once */
+            if (visited.find(node) != visited.end())
+              return false;
 
-        return node;
+            /* A reference is replaced by the full AST of its expression, which is built once */
+            if (node->getKind() == triton::ast::REFERENCE_NODE) {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+              triton::ast::AbstractNode* partial = this->getSymbolicExpressionFromId(id)->getAst();
+
+              /* Any AST in use may have changed since another generation, deeper expressions included */
+              auto it = this->fullAsts.find(id);
+              if (it != this->fullAsts.end() && it->second.first == triton::ast::AbstractNode::getGeneration()) {
+                visited[node] = it->second.second;
+                return false;
+              }
+
+              successors.push_back(partial);
+              return true;
+            }
+
+            for (triton::ast::AbstractNode* child : node->getChilds())
+              successors.push_back(child);
+            return true;
+          },
+          [this, &visited](triton::ast::AbstractNode* node) {
+            if (node->getKind() == triton::ast::REFERENCE_NODE) {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+              triton::ast::AbstractNode* partial = this->getSymbolicExpressionFromId(id)->getAst();
+              triton::ast::AbstractNode* full = visited[partial];
+              full->incReferenceCount();
+
+              /* The ASTs have changed since the last unrolling */
+              auto& entry = this->fullAsts[id];
+              if (entry.second != nullptr)
+                entry.second->decReferenceCount();
+              entry = std::make_pair(triton::ast::AbstractNode::getGeneration(), full);
+
+              visited[node] = full;
+              return;
+            }
+
+            /* The childs are unrolled, the node is copied once one of them changes */
+            triton::ast::AbstractNode* full = node;
+            for (triton::uint32 index = 0; index < node->getChilds().size(); index++) {
+              triton::ast::AbstractNode* child = visited[node->getChilds()[index]];
+              if (child == node->getChilds()[index])
+                continue;
+
+              if (full == node)
+                full = triton::ast::newInstance(node, false);
+              full->setChild(index, child);
+            }
+
+            if (full != node) {
+              full->init();
+              full = triton::api.recordAstNode(full);
+            }
+
+            visited[node] = full;
+          });
+
+        return visited[root];
       }
 
 
       /* Returns the full symbolic expression backtracked. */
       triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node) {
-        std::set<triton::usize> processed;
-        return this->getFullAst(node, processed);
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> visited;
+        return this->unrollAst(node, visited);
+      }
+
+
+      void SymbolicEngine::invalidateFullAsts(void) {
+        for (auto it = this->fullAsts.begin(); it != this->fullAsts.end(); it++)
+          it->second.second->decReferenceCount();
+        this->fullAsts.clear();
       }
 
 
       /* [private method] Slices all expressions from a given node */
-      void SymbolicEngine::sliceExpressions(triton::ast::AbstractNode* node, std::map<triton::usize, SymbolicExpression*>& exprs) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+      void SymbolicEngine::sliceExpressions(triton::ast::AbstractNode* root, std::map<triton::usize, SymbolicExpression*>& exprs) {
+        std::unordered_set<triton::ast::AbstractNode*> visited;
 
-        for (triton::uint32 index = 0; index < childs.size(); index++) {
-          if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
-            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
+        triton::ast::preOrderWalk(root, [this, &exprs, &visited](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+          /* A subtree shared by several nodes is sliced once */
+          if (!visited.insert(node).second)
+            return false;
+
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
             if (exprs.find(id) == exprs.end()) {
               SymbolicExpression* expr = this->getSymbolicExpressionFromId(id);
               exprs[id] = expr;
-              this->sliceExpressions(expr->getAst(), exprs);
+              successors.push_back(expr->getAst());
             }
           }
-          this->sliceExpressions(childs[index], exprs);
-        }
+
+          for (triton::ast::AbstractNode* child : node->getChilds())
+            successors.push_back(child);
+          return true;
+        });
       }
 
 
@@ -503,7 +589,7 @@ namespace triton {
 
       /* Returns a list which contains all tainted expressions */
       std::list<SymbolicExpression*> SymbolicEngine::getTaintedSymbolicExpressions(void) const {
-        std::map<triton::usize, SymbolicExpression*>::const_iterator it;
+        SymbolicStorage<SymbolicExpression>::const_iterator it;
         std::list<SymbolicExpression*> taintedExprs;
 
         for (it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
@@ -516,7 +602,7 @@ namespace triton {
 
       /* Returns the list of the symbolic variables declared in the trace */
       std::string SymbolicEngine::getVariablesDeclaration(void) const {
-        std::map<triton::usize, SymbolicVariable*>::const_iterator it;
+        SymbolicStorage<SymbolicVariable>::const_iterator it;
         std::stringstream stream;
 
         for(it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++)
@@ -544,10 +630,13 @@ namespace triton {
       /* Returns the map of symbolic memory defined */
       std::map<triton::uint64, SymbolicExpression*> SymbolicEngine::getSymbolicMemory(void) const {
         std::map<triton::uint64, SymbolicExpression*> ret;
-        std::map<triton::uint64, triton::usize>::const_iterator it;
 
-        for (it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
-          ret[it->first] = this->getSymbolicExpressionFromId(it->second);
+        for (const auto& page : this->memoryReference.getPages()) {
+          for (triton::uint64 index = 0; index < MEMORY_PAGE_SIZE; index++) {
+            if (page.second.ids[index] != triton::engines::symbolic::UNSET)
+              ret[(page.first << MEMORY_PAGE_BITS) + index] = this->getSymbolicExpressionFromId(page.second.ids[index]);
+          }
+        }
 
         return ret;
       }
@@ -573,6 +662,7 @@ namespace triton {
         tmp->setParent(expression->getAst()->getParents());
         expression->setAst(tmp);
         tmp->init();
+        this->invalidateFullAsts();
 
         return symVar;
       }
@@ -614,6 +704,7 @@ namespace triton {
             tmp->setParent(se->getAst()->getParents());
             se->setAst(tmp);
             tmp->init();
+            this->invalidateFullAsts();
             se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE, tmp->evaluate()));
           }
 
@@ -665,6 +756,7 @@ namespace triton {
           tmp->setParent(expression->getAst()->getParents());
           expression->setAst(tmp);
           tmp->init();
+          this->invalidateFullAsts();
         }
 
         return symVar;
@@ -679,7 +771,7 @@ namespace triton {
         if (symVar == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
 
-        this->symbolicVariables[uniqueId] = symVar;
+        this->symbolicVariables.set(uniqueId, symVar);
         return symVar;
       }
 
@@ -743,9 +835,12 @@ namespace triton {
         if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY) && this->isAlignedMemory(address, size))
           return this->getAlignedMemory(address, size);
 
+        /* If no cell is symbolic, the pages are enough to know it */
+        bool concrete = this->memoryReference.isConcrete(address, size);
+
         /* Iterate on every memory cells to use their symbolic or concrete values */
         while (size) {
-          symMem = this->getSymbolicMemoryId(address + size - 1);
+          symMem = concrete ? triton::engines::symbolic::UNSET : this->getSymbolicMemoryId(address + size - 1);
           /* Check if the memory cell is already symbolic */
           if (symMem != triton::engines::symbolic::UNSET) {
             tmp = triton::ast::reference(symMem);
@@ -969,7 +1064,7 @@ namespace triton {
 
       /* Adds and assign a new memory reference */
       void SymbolicEngine::addMemoryReference(triton::uint64 mem, triton::usize id) {
-        this->memoryReference[mem] = id;
+        this->memoryReference.set(mem, id);
       }
 
 
@@ -1034,9 +1129,7 @@ namespace triton {
 
       /* Returns true if the symbolic expression ID exists */
       bool SymbolicEngine::isSymbolicExpressionIdExists(triton::usize symExprId) const {
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end())
-          return true;
-        return false;
+        return (this->symbolicExpressions.get(symExprId) != nullptr);
       }
 
 
@@ -1051,6 +1144,9 @@ namespace triton {
 
       /* Returns true if memory cell expressions contain symbolic variables. */
       bool SymbolicEngine::isMemorySymbolized(triton::uint64 addr, triton::uint32 size) const {
+        if (this->memoryReference.isConcrete(addr, size))
+          return false;
+
         for (triton::uint32 i = 0; i < size; i++) {
           triton::usize symId = this->getSymbolicMemoryId(addr+i);
 
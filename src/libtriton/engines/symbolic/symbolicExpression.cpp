@@ -21,6 +21,10 @@ namespace triton {
         this->id            = id;
         this->isTainted     = false;
         this->kind          = kind;
+
+        /* The expression references its AST */
+        if (node != nullptr)
+          node->incReferenceCount();
       }
 
 
@@ -53,7 +57,8 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedId(void) const {
-        if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION)
+        if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION ||
+            triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_DAG_REPRESENTATION)
           return "ref!" + std::to_string(this->id);
 
         else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::PYTHON_REPRESENTATION)
@@ -68,7 +73,8 @@ namespace triton {
         if (this->getComment().empty())
           return "";
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION)
+        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION ||
+                 triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_DAG_REPRESENTATION)
           return "; " + this->getComment();
 
         else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::PYTHON_REPRESENTATION)
@@ -96,8 +102,11 @@ namespace triton {
 
       void SymbolicExpression::setAst(triton::ast::AbstractNode* node) {
         node->setParent(this->ast->getParents());
+        node->incReferenceCount();
+        this->ast->decReferenceCount();
         this->ast = node;
         this->ast->init();
+        triton::ast::AbstractNode::nextGeneration();
       }
 
 
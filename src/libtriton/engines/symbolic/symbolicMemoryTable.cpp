@@ -0,0 +1,117 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/symbolicEnums.hpp>
+#include <triton/symbolicMemoryTable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SymbolicMemoryTable::SymbolicMemoryTable() {
+        this->count = 0;
+      }
+
+
+      triton::usize SymbolicMemoryTable::get(triton::uint64 addr) const {
+        auto it = this->pages.find(addr >> MEMORY_PAGE_BITS);
+
+        if (it == this->pages.end())
+          return triton::engines::symbolic::UNSET;
+
+        return it->second.ids[addr & (MEMORY_PAGE_SIZE - 1)];
+      }
+
+
+      void SymbolicMemoryTable::set(triton::uint64 addr, triton::usize id) {
+        if (id == triton::engines::symbolic::UNSET) {
+          this->erase(addr);
+          return;
+        }
+
+        Page& page = this->pages[addr >> MEMORY_PAGE_BITS];
+        if (page.ids.empty()) {
+          page.ids.assign(MEMORY_PAGE_SIZE, triton::engines::symbolic::UNSET);
+          page.count = 0;
+        }
+
+        triton::usize& slot = page.ids[addr & (MEMORY_PAGE_SIZE - 1)];
+        if (slot == triton::engines::symbolic::UNSET) {
+          page.count++;
+          this->count++;
+        }
+        slot = id;
+      }
+
+
+      void SymbolicMemoryTable::erase(triton::uint64 addr) {
+        auto it = this->pages.find(addr >> MEMORY_PAGE_BITS);
+
+        if (it == this->pages.end())
+          return;
+
+        triton::usize& slot = it->second.ids[addr & (MEMORY_PAGE_SIZE - 1)];
+        if (slot == triton::engines::symbolic::UNSET)
+          return;
+
+        slot = triton::engines::symbolic::UNSET;
+        this->count--;
+
+        /* The page is free with its last byte */
+        if (--it->second.count == 0)
+          this->pages.erase(it);
+      }
+
+
+      void SymbolicMemoryTable::clear(void) {
+        this->pages.clear();
+        this->count = 0;
+      }
+
+
+      bool SymbolicMemoryTable::isConcrete(triton::uint64 addr, triton::uint64 size) const {
+        if (this->count == 0 || size == 0)
+          return true;
+
+        /* The range may wrap around the address space */
+        triton::uint64 last = addr + size - 1;
+        for (triton::uint64 number = addr >> MEMORY_PAGE_BITS; ; number = (number + 1) & (static_cast<triton::uint64>(-1) >> MEMORY_PAGE_BITS)) {
+          auto it = this->pages.find(number);
+
+          if (it != this->pages.end()) {
+            /* The bytes of the range in this page */
+            triton::uint64 begin = (number == (addr >> MEMORY_PAGE_BITS)) ? (addr & (MEMORY_PAGE_SIZE - 1)) : 0;
+            triton::uint64 end   = (number == (last >> MEMORY_PAGE_BITS)) ? (last & (MEMORY_PAGE_SIZE - 1)) : (MEMORY_PAGE_SIZE - 1);
+            for (triton::uint64 index = begin; index <= end; index++) {
+              if (it->second.ids[index] != triton::engines::symbolic::UNSET)
+                return false;
+            }
+          }
+
+          if (number == (last >> MEMORY_PAGE_BITS))
+            break;
+        }
+
+        return true;
+      }
+
+
+      triton::usize SymbolicMemoryTable::size(void) const {
+        return this->count;
+      }
+
+
+      const std::unordered_map<triton::uint64, SymbolicMemoryTable::Page>& SymbolicMemoryTable::getPages(void) const {
+        return this->pages;
+      }
+
+    };
+  };
+};
+
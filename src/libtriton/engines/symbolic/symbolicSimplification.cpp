@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <triton/api.hpp>
+#include <triton/astWalker.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/symbolicSimplification.hpp>
 
@@ -29,6 +31,11 @@ triton::ast::AbstractNode. Then, your callback will be called before every symbo
 Note that you can record several simplification callbacks or remove a specific callback using the
 triton::API::removeCallback() function.
 
+A callback which only rewrites some operators can be recorded with the kinds of root it applies to, and optionally
+a minimum size, e.g. `api.addCallback(xor_simplification, {triton::ast::BVXOR_NODE})`. The callbacks are then looked
+up in a table indexed by the kind of the root, and the other roots never call them. This matters for Python callbacks,
+as each call goes through the interpreter.
+
 \subsection SMT_simplification_triton Simplification via Triton's rules
 <hr>
 
@@ -107,6 +114,30 @@ if __name__ == "__main__":
     print 'Simp: ', c
 ~~~~~~~~~~~~~
 
+\subsection SMT_simplification_rules Simplification via rewriting rules
+<hr>
+
+Instead of walking the AST in a callback, you can record rules written as `pattern -> replacement` with
+triton::API::addSimplificationRule(). The rules are indexed by the kind of the root of their pattern and
+applied bottom-up on each new node, before the callbacks. A shared sub-tree is rewritten once, and a
+rewritten node is rewritten again until no rule matches. In a pattern, a name like `x` matches any node (all its
+occurrences must match equal nodes), a number matches a constant, and the childs of commutative operators
+are matched in both orders. triton::API::addDefaultSimplificationRules() records the built-in rules: folding of
+the operations on constants, identities like \f$ A + 0 \rightarrow A \f$ and some mixed boolean-arithmetic
+identities like \f$ (A \lor B) - (A \land B) \rightarrow A \oplus B \f$.
+
+~~~~~~~~~~~~~{.py}
+>>> addSimplificationRule('(bvsub (bvor x y) (bvand x y)) -> (bvxor x y)')
+>>> a = variable(newSymbolicVariable(8))
+>>> b = variable(newSymbolicVariable(8))
+>>> print simplify((a | b) - (a & b))
+(bvxor SymVar_0 SymVar_1)
+
+>>> addDefaultSimplificationRules()
+>>> print simplify(a + (bv(3, 8) - bv(3, 8)))
+SymVar_0
+~~~~~~~~~~~~~
+
 \subsection SMT_simplification_z3 Simplification via Z3
 <hr>
 
@@ -159,9 +190,91 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      /* A replacement is rewritten again at most this many times, in case of rules which undo each other */
+      static const triton::uint32 MAX_REWRITING_DEPTH = 32;
+
+
+      /* The built-in rules, for any size */
+      static const char* defaultRules[] = {
+        "(bvadd x 0) -> x",
+        "(bvsub x 0) -> x",
+        "(bvsub x x) -> 0",
+        "(bvsub 0 x) -> (bvneg x)",
+        "(bvmul x 0) -> 0",
+        "(bvmul x 1) -> x",
+        "(bvand x 0) -> 0",
+        "(bvand x -1) -> x",
+        "(bvand x x) -> x",
+        "(bvand x (bvnot x)) -> 0",
+        "(bvor x 0) -> x",
+        "(bvor x -1) -> -1",
+        "(bvor x x) -> x",
+        "(bvor x (bvnot x)) -> -1",
+        "(bvxor x 0) -> x",
+        "(bvxor x -1) -> (bvnot x)",
+        "(bvxor x x) -> 0",
+        "(bvxor x (bvnot x)) -> -1",
+        "(bvnot (bvnot x)) -> x",
+        "(bvneg (bvneg x)) -> x",
+        "(bvadd (bvnot x) 1) -> (bvneg x)",
+        "(bvshl x 0) -> x",
+        "(bvlshr x 0) -> x",
+        "(bvashr x 0) -> x",
+        /* Mixed boolean-arithmetic */
+        "(bvsub (bvor x y) (bvand x y)) -> (bvxor x y)",
+        "(bvsub (bvor x y) (bvxor x y)) -> (bvand x y)",
+        "(bvsub (bvadd x y) (bvand x y)) -> (bvor x y)",
+        "(bvadd (bvand x y) (bvor x y)) -> (bvadd x y)",
+        "(bvadd (bvxor x y) (bvmul 2 (bvand x y))) -> (bvadd x y)",
+        "(bvor (bvand x (bvnot y)) (bvand (bvnot x) y)) -> (bvxor x y)",
+      };
+
+
+      /* Returns true if the node is a bitvector operation whose value is known */
+      static bool isFoldable(triton::ast::AbstractNode* node) {
+        switch (node->getKind()) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVASHR_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNEG_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVNOT_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE:
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVSHL_NODE:
+          case triton::ast::BVSMOD_NODE:
+          case triton::ast::BVSREM_NODE:
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVUDIV_NODE:
+          case triton::ast::BVUREM_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::CONCAT_NODE:
+          case triton::ast::EXTRACT_NODE:
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE:
+            break;
+          default:
+            return false;
+        }
+
+        for (triton::ast::AbstractNode* child : node->getChilds()) {
+          if (child->getKind() != triton::ast::BV_NODE && child->getKind() != triton::ast::DECIMAL_NODE)
+            return false;
+        }
+
+        return true;
+      }
+
 
       SymbolicSimplification::SymbolicSimplification(triton::callbacks::Callbacks* callbacks) {
-        this->callbacks = callbacks;
+        this->callbacks       = callbacks;
+        this->constantFolding = false;
       }
 
 
@@ -175,7 +288,9 @@ namespace triton {
 
 
       void SymbolicSimplification::copy(const SymbolicSimplification& other) {
-        this->callbacks = other.callbacks;
+        this->callbacks       = other.callbacks;
+        this->rules           = other.rules;
+        this->constantFolding = other.constantFolding;
       }
 
 
@@ -183,6 +298,12 @@ namespace triton {
         if (node == nullptr)
           throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::processSimplification(): node cannot be null.");
 
+        /* apply the rewriting rules */
+        if (this->constantFolding || !this->rules.empty()) {
+          std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> rewritten;
+          node = this->rewrite(node, rewritten, 0);
+        }
+
         /* process recorded callback about symbolic simplifications */
         if (this->callbacks)
           node = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
@@ -191,6 +312,97 @@ namespace triton {
       }
 
 
+      triton::ast::AbstractNode* SymbolicSimplification::rewrite(triton::ast::AbstractNode* root, std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& rewritten, triton::uint32 depth) const {
+        triton::ast::postOrderWalk(root,
+          [&rewritten](triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& successors) {
+            /* A subtree shared by several nodes is rewritten once */
+            if (rewritten.find(node) != rewritten.end())
+              return false;
+
+            for (triton::ast::AbstractNode* child : node->getChilds())
+              successors.push_back(child);
+            return true;
+          },
+          [this, &rewritten, depth](triton::ast::AbstractNode* node) {
+            /* The childs are rewritten, the node is copied once one of them changes */
+            triton::ast::AbstractNode* result = node;
+            for (triton::uint32 index = 0; index < node->getChilds().size(); index++) {
+              triton::ast::AbstractNode* child = rewritten[node->getChilds()[index]];
+              if (child == node->getChilds()[index])
+                continue;
+
+              if (result == node)
+                result = triton::ast::newInstance(node, false);
+              result->setChild(index, child);
+            }
+
+            if (result != node) {
+              result->init();
+              result = triton::api.recordAstNode(result);
+            }
+
+            /* The new nodes of a replacement may match other rules, the others are already rewritten */
+            triton::ast::AbstractNode* replacement = this->rewriteNode(result);
+            if (replacement != nullptr)
+              result = (depth < MAX_REWRITING_DEPTH) ? this->rewrite(replacement, rewritten, depth + 1) : replacement;
+
+            rewritten[node]   = result;
+            rewritten[result] = result;
+          });
+
+        return rewritten[root];
+      }
+
+
+      triton::ast::AbstractNode* SymbolicSimplification::rewriteNode(triton::ast::AbstractNode* node) const {
+        if (this->constantFolding && isFoldable(node))
+          return triton::ast::bv(node->evaluate(), node->getBitvectorSize());
+
+        auto it = this->rules.find(node->getKind());
+        if (it == this->rules.end())
+          return nullptr;
+
+        for (const SimplificationRule& rule : it->second) {
+          triton::ast::AbstractNode* result = rule.apply(node);
+          if (result != nullptr)
+            return result;
+        }
+
+        return nullptr;
+      }
+
+
+      void SymbolicSimplification::addSimplificationRule(const std::string& rule) {
+        SimplificationRule parsed(rule);
+        this->rules[parsed.getKind()].push_back(parsed);
+      }
+
+
+      void SymbolicSimplification::addDefaultSimplificationRules(void) {
+        for (const char* rule : defaultRules)
+          this->addSimplificationRule(rule);
+        this->constantFolding = true;
+      }
+
+
+      void SymbolicSimplification::clearSimplificationRules(void) {
+        this->rules.clear();
+        this->constantFolding = false;
+      }
+
+
+      std::vector<std::string> SymbolicSimplification::getSimplificationRules(void) const {
+        std::vector<std::string> ret;
+
+        for (auto it = this->rules.begin(); it != this->rules.end(); it++) {
+          for (const SimplificationRule& rule : it->second)
+            ret.push_back(rule.getRule());
+        }
+
+        return ret;
+      }
+
+
       void SymbolicSimplification::operator=(const SymbolicSimplification& other) {
         this->copy(other);
       }
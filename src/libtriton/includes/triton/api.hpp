@@ -12,6 +12,7 @@
 #include <triton/ast.hpp>
 #include <triton/astGarbageCollector.hpp>
 #include <triton/astRepresentation.hpp>
+#include <triton/astTape.hpp>
 #include <triton/callbacks.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
@@ -22,6 +23,7 @@
 #include <triton/register.hpp>
 #include <triton/registerSpecification.hpp>
 #include <triton/solverEngine.hpp>
+#include <triton/solverSession.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/taintEngine.hpp>
 #include <triton/tritonTypes.hpp>
@@ -58,6 +60,9 @@ namespace triton {
         //! The solver engine.
         triton::engines::solver::SolverEngine* solver = nullptr;
 
+        //! The incremental solver session over the path constraints.
+        triton::engines::solver::SolverSession* solverSession = nullptr;
+
         //! The AST garbage collector interface.
         triton::ast::AstGarbageCollector* astGarbageCollector = nullptr;
 
@@ -243,11 +248,14 @@ namespace triton {
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
         //! [**AST garbage collector api**] - Returns all allocated nodes.
-        const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
+        const std::vector<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
 
         //! [**AST garbage collector api**] - Returns all stats about AST Dictionaries.
         std::map<std::string, triton::usize> getAstDictionariesStats(void) const;
 
+        //! [**AST garbage collector api**] - Returns the memory used by the live AST nodes.
+        std::map<std::string, triton::usize> getAstMemoryStats(void) const;
+
         //! [**AST garbage collector api**] - Returns all variable nodes recorded.
         const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
 
@@ -255,7 +263,7 @@ namespace triton {
         triton::ast::AbstractNode* getAstVariableNode(const std::string& name) const;
 
         //! [**AST garbage collector api**] - Sets all allocated nodes.
-        void setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes);
+        void setAllocatedAstNodes(const std::vector<triton::ast::AbstractNode*>& nodes);
 
         //! [**AST garbage collector api**] - Sets all variable nodes recorded.
         void setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes);
@@ -283,6 +291,9 @@ namespace triton {
         //! [**callbacks api**] - Adds a SYMBOLIC_SIMPLIFICATION callback.
         void addCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! [**callbacks api**] - Adds a SYMBOLIC_SIMPLIFICATION callback only called on the roots of kind `kinds` (all kinds if empty) and of `minSize` bits or more.
+        void addCallback(triton::callbacks::symbolicSimplificationCallback cb, const std::set<triton::ast::kind_e>& kinds, triton::uint32 minSize=0);
+
         //! [**callbacks api**] - Removes all recorded callbacks.
         void removeAllCallbacks(void);
 
@@ -417,6 +428,18 @@ namespace triton {
         //! [**symbolic api**] - Processes all recorded simplifications. Returns the simplified node.
         triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node, bool z3=false) const;
 
+        //! [**symbolic api**] - Adds a rewriting rule applied by processSimplification(). See triton::engines::symbolic::SimplificationRule.
+        void addSimplificationRule(const std::string& rule);
+
+        //! [**symbolic api**] - Adds the built-in rewriting rules: constant folding, identities and mixed boolean-arithmetic identities.
+        void addDefaultSimplificationRules(void);
+
+        //! [**symbolic api**] - Removes all rewriting rules.
+        void clearSimplificationRules(void);
+
+        //! [**symbolic api**] - Returns the rewriting rules.
+        std::vector<std::string> getSimplificationRules(void) const;
+
         //! [**symbolic api**] - Returns the symbolic expression corresponding to an id.
         triton::engines::symbolic::SymbolicExpression* getSymbolicExpressionFromId(triton::usize symExprId) const;
 
@@ -480,6 +503,9 @@ namespace triton {
         //! [**symbolic api**] - Returns the full AST from a symbolic expression id.
         triton::ast::AbstractNode* getFullAstFromId(triton::usize symExprId);
 
+        //! [**symbolic api**] - Compiles an AST for repeated evaluations under different values of its symbolic variables.
+        triton::ast::AstTape compileAst(triton::ast::AbstractNode* node) const;
+
         //! [**symbolic api**] - Slices all expressions from a given one.
         std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> sliceExpressions(triton::engines::symbolic::SymbolicExpression* expr);
 
@@ -487,10 +513,10 @@ namespace triton {
         std::list<triton::engines::symbolic::SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
         //! [**symbolic api**] - Returns all symbolic expressions as a map of <SymExprId : SymExpr>
-        const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& getSymbolicExpressions(void) const;
+        const triton::engines::symbolic::SymbolicStorage<triton::engines::symbolic::SymbolicExpression>& getSymbolicExpressions(void) const;
 
         //! [**symbolic api**] - Returns all symbolic variables as a map of <SymVarId : SymVar>
-        const std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>& getSymbolicVariables(void) const;
+        const triton::engines::symbolic::SymbolicStorage<triton::engines::symbolic::SymbolicVariable>& getSymbolicVariables(void) const;
 
 
 
@@ -508,6 +534,17 @@ namespace triton {
          */
         std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(triton::ast::AbstractNode* node) const;
 
+        /*!
+         * \brief [**solver api**] - Computes and returns a model from a symbolic constraint with per-call limits (time in ms, memory in MB, conflicts).
+         *
+         * \description
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         *
+         * A zero limit falls back on the global one. See getSolverQueryStats() to know why a model is empty.
+         */
+        std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(triton::ast::AbstractNode* node, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit) const;
+
         /*!
          * \brief [**solver api**] - Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
          *
@@ -517,6 +554,74 @@ namespace triton {
          */
         std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const;
 
+        //! [**solver api**] - Computes and returns several models from a symbolic constraint with per-call limits. A zero limit falls back on the global one.
+        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit) const;
+
+        /*!
+         * \brief [**solver api**] - Computes and returns a model for every untaken branch of the path constraints via the incremental solver session.
+         *
+         * \description
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         *
+         * Models are in the order of the trace and a model is empty if its branch cannot be taken.
+         */
+        const std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>>& getModelsForUntakenBranches(void);
+
+        /*!
+         * \brief [**solver api**] - Computes and returns a model for every untaken branch of `pathConstraints` on at most `maxThreads` threads.
+         *
+         * \description
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         *
+         * Models are in the order of the branches and a model is empty if its branch cannot be taken.
+         * If `maxThreads` is 0, the number of hardware threads is used.
+         */
+        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModelsForAllBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 maxThreads) const;
+
+        /*!
+         * \brief [**solver api**] - Translates the untaken branches of `pathConstraints` for at most `maxThreads` threads.
+         *
+         * \description
+         * This is the first half of getModelsForAllBranches(). `branches` is then solved by
+         * triton::engines::solver::SolverBranches::solve(), which does not read the engines anymore.
+         */
+        void translateBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 maxThreads, triton::engines::solver::SolverBranches& branches) const;
+
+        /*!
+         * \brief [**solver api**] - Computes and returns a model from a symbolic constraint conjoined with the path constraints via the incremental solver session.
+         *
+         * \description
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        std::map<triton::uint32, triton::engines::solver::SolverModel> getModelUnderPathConstraints(triton::ast::AbstractNode* node);
+
+        //! [**solver api**] - Drops all assertions of the incremental solver session.
+        void resetSolverSession(void);
+
+        //! [**solver api**] - Returns the statistics of the solver query cache (entries, bytes, max_bytes, evicted, hits, misses and reused).
+        std::map<std::string, triton::usize> getSolverCacheStats(void) const;
+
+        //! [**solver api**] - Clears the solver query cache.
+        void clearSolverCache(void);
+
+        //! [**solver api**] - Sets the size limit of the solver query cache in bytes (0 means no limit).
+        void setSolverCacheLimit(triton::usize maxBytes);
+
+        //! [**solver api**] - Sets the global time limit of a query in milliseconds (0 means no limit).
+        void setSolverTimeout(triton::uint32 timeout);
+
+        //! [**solver api**] - Sets the global memory limit of a query in megabytes (0 means no limit).
+        void setSolverMemoryLimit(triton::uint32 memoryLimit);
+
+        //! [**solver api**] - Sets the global conflict limit of a query (0 means no limit).
+        void setSolverConflictLimit(triton::uint32 conflictLimit);
+
+        //! [**solver api**] - Returns the statistics of the last query solved by getModel() or getModels() (status, nodes, variables, translation_time and solving_time).
+        const std::map<std::string, triton::usize>& getSolverQueryStats(void) const;
+
 
 
         /* Z3 interface API ============================================================================== */
@@ -8,8 +8,10 @@
 #ifndef TRITON_AST_H
 #define TRITON_AST_H
 
+#include <cstddef>
 #include <list>
 #include <map>
+#include <new>
 #include <ostream>
 #include <set>
 #include <stdexcept>
@@ -17,6 +19,7 @@
 #include <vector>
 
 #include <triton/astEnums.hpp>
+#include <triton/astSmallVector.hpp>
 #include <triton/astVisitor.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
@@ -38,32 +41,82 @@ namespace triton {
    *  @{
    */
 
+    class AbstractNode;
+
+    //! The childs of a node. Operators take at most three operands, so the childs live in the node itself.
+    typedef SmallVector<AbstractNode*, 3> ChildVector;
+
+    //! The parents of a node, unsorted. Most nodes have a single parent.
+    typedef SmallVector<AbstractNode*, 1> ParentVector;
+
     //! Abstract node
     class AbstractNode {
       protected:
-        //! The kind of the node.
-        enum kind_e kind;
-
         //! The childs of the node.
-        std::vector<AbstractNode*> childs;
+        ChildVector childs;
 
         //! The parents of the node. Empty if there is still no parent.
-        std::set<AbstractNode*> parents;
+        ParentVector parents;
+
+        //! The structural hash of the tree from this root node.
+        triton::uint64 hash;
+
+        //! The value of the tree from this root node if the node is 64 bits wide or fewer. Computed on demand, see evaluate().
+        mutable triton::uint64 nativeEval;
+
+        //! The value of the tree from this root node if the node is wider than 64 bits, allocated out of line. Computed on demand, see evaluate().
+        mutable triton::uint512* wideEval;
 
         //! The size of the node.
         triton::uint32 size;
 
-        //! The value of the tree from this root node.
-        triton::uint512 eval;
+        //! The number of references to the node: one per parent which has the node as child and one per symbolic expression.
+        triton::uint32 references;
+
+        //! The position of the node in the nodes recorded by the garbage collector (See: triton::ast::AstGarbageCollector).
+        triton::uint32 recordIndex;
+
+        //! The kind of the node (enum kind_e). Stored on 16 bits to keep the node in 96 bytes.
+        triton::uint16 kind;
+
+        //! True if the value of the tree must be computed again.
+        mutable bool dirty;
 
         //! This value is set to true if the tree contains a symbolic variable.
         bool symbolized;
 
+        //! Computes the hash from the kind, the size, the value and the hashes of the childs. Called by init().
+        void initHash(void);
+
+        //! Computes the value of the tree. Leaves compute their value in init() and do not override it.
+        virtual void computeEval(void) const;
+
+        //! Computes the value of the dirty nodes of the tree, childs first, without recursion.
+        void computeDirtyEvals(void) const;
+
+        //! Sets the value of the tree.
+        void setEval(const triton::uint512& value) const;
+
+        //! Sets the value of a tree of 64 bits or fewer.
+        void setNativeEval(triton::uint64 value) const;
+
+        //! Sets the out of line value of a tree wider than 64 bits.
+        void setWideEval(const triton::uint512& value) const;
+
+        //! The generation of the trees in use, see getGeneration().
+        static triton::usize generation;
+
+        //! The number of nodes freed since the start, see getFreedNodes().
+        static triton::usize freedNodes;
+
+        //! Init stuffs like size from the childs of the node only. Called by init().
+        virtual void initNode(void) = 0;
+
       public:
         //! Constructor.
         AbstractNode(enum kind_e kind);
 
-        //! Constructor by copy.
+        //! Constructor by copy. The copy shares the childs of the original node.
         AbstractNode(const AbstractNode& copy);
 
         //! Constructor.
@@ -72,6 +125,18 @@ namespace triton {
         //! Destructor.
         virtual ~AbstractNode();
 
+        //! Allocates a node from the AST allocator (See: triton::ast::AstAllocator).
+        static void* operator new(std::size_t size);
+
+        //! Allocates a node from the AST allocator. Returns nullptr if there is not enough memory.
+        static void* operator new(std::size_t size, const std::nothrow_t&) throw();
+
+        //! Gives a node back to the AST allocator.
+        static void operator delete(void* ptr, std::size_t size);
+
+        //! Gives a node back to the AST allocator when its constructor throws.
+        static void operator delete(void* ptr, const std::nothrow_t&) throw();
+
         //! Returns the kind of the node.
         enum kind_e getKind(void) const;
 
@@ -81,58 +146,101 @@ namespace triton {
         //! Returns the vector mask according the size of the node.
         triton::uint512 getBitvectorMask(void) const;
 
+        //! Returns the vector mask according the size of the node if the node is 64 bits wide or fewer.
+        triton::uint64 getNativeMask(void) const;
+
         //! According to the size of the expression, returns true if the MSB is 1.
         bool isSigned(void) const;
 
         //! Returns true if the tree contains a symbolic variable.
         bool isSymbolized(void) const;
 
-        //! Returns true if the current tree is equal to the second one.
+        //! Returns true if the current tree is structurally equal to the second one. The childs of commutative operators may be swapped.
         bool equalTo(const AbstractNode&) const;
 
         //! Returns true if the current tree is equal to the second one.
         bool equalTo(AbstractNode*) const;
 
-        //! Evaluates the tree.
+        //! Evaluates the tree. The value is computed on demand and kept until the tree changes.
         triton::uint512 evaluate(void) const;
 
+        //! Evaluates the tree with native integers. Returns the low 64 bits of the value if the node is wider than 64 bits.
+        triton::uint64 evaluateNative(void) const;
+
+        //! Returns the number of references to the node. A node which is not referenced anymore may be freed (See: triton::ast::AstGarbageCollector::freeUnreferencedAstNodes()).
+        triton::uint32 getReferenceCount(void) const;
+
+        //! Adds a reference to the node.
+        void incReferenceCount(void);
+
+        //! Removes a reference to the node and returns the number of references left.
+        triton::uint32 decReferenceCount(void);
+
+        //! Returns the position of the node in the nodes recorded by the garbage collector.
+        triton::uint32 getRecordIndex(void) const;
+
+        //! Sets the position of the node in the nodes recorded by the garbage collector.
+        void setRecordIndex(triton::uint32 index);
+
         //! Returns the childs of the node.
-        std::vector<AbstractNode*>& getChilds(void);
+        ChildVector& getChilds(void);
 
         /*!
-         * \brief Returns the parents of node or an empty set if there is still no parent defined.
+         * \brief Returns the parents of node or an empty vector if there is still no parent defined.
          *
          * Note that if there is the `AST_DICTIONARIES` optimization enabled, this feature will
          * probably not represent the real tree of your expression.
          */
-        std::set<AbstractNode*>& getParents(void);
+        ParentVector& getParents(void);
 
         //! Removes a parent node.
         void removeParent(AbstractNode* p);
 
-        //! Sets a parent node.
+        //! Sets a parent node. `p` must not already be a parent of the node.
         void setParent(AbstractNode* p);
 
-        //! Sets the parent nodes.
-        void setParent(std::set<AbstractNode*>& p);
+        //! Sets the parent nodes which are not already parents of the node.
+        void setParent(ParentVector& p);
 
         //! Sets the size of the node.
         void setBitvectorSize(triton::uint32 size);
 
-        //! Adds a child.
+        //! Adds a child. The child gets a reference.
         void addChild(AbstractNode* child);
 
-        //! Sets a child at an index.
+        //! Sets a child at an index. The generation changes if the node is referenced (See: getGeneration()).
         void setChild(triton::uint32 index, AbstractNode* child);
 
-        //! Init stuffs like size and eval.
-        virtual void init(void) = 0;
+        /*!
+         * \brief Returns the generation of the trees in use.
+         *
+         * \description
+         * The generation changes each time a referenced node gets another child, or a symbolic expression
+         * gets another AST. A result computed from trees in use stays valid as long as the generation does
+         * not change (e.g. the full ASTs of triton::engines::symbolic::SymbolicEngine::getFullAst()).
+         */
+        static triton::usize getGeneration(void);
+
+        //! Changes the generation of the trees in use.
+        static void nextGeneration(void);
+
+        //! Returns the number of nodes freed since the start. A cache keyed by node addresses is stale once it has changed.
+        static triton::usize getFreedNodes(void);
+
+        /*!
+         * \brief Init stuffs like size, then the ancestors of the node. The value is marked to be computed again (see evaluate()).
+         *
+         * \description
+         * The ancestors are walked with an explicit stack and each of them is initialized once, after all the nodes
+         * it depends on, instead of a call per path from the node.
+         */
+        void init(void);
 
         //! Entry point for a visitor.
         virtual void accept(AstVisitor& v) = 0;
 
-        //! Returns the has of the tree. The hash is computed recursively on the whole tree.
-        virtual triton::uint512 hash(triton::uint32 deep) const = 0;
+        //! Returns the structural hash of the tree. The hash is computed once by init().
+        triton::uint64 getHash(void) const;
     };
 
 
@@ -142,9 +250,8 @@ namespace triton {
         AssertNode(AbstractNode* expr);
         AssertNode(const AssertNode& copy);
         virtual ~AssertNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -154,9 +261,9 @@ namespace triton {
         BvaddNode(AbstractNode* expr1, AbstractNode* expr2);
         BvaddNode(const BvaddNode& copy);
         virtual ~BvaddNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -166,9 +273,9 @@ namespace triton {
         BvandNode(AbstractNode* expr1, AbstractNode* expr2);
         BvandNode(const BvandNode& copy);
         virtual ~BvandNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -178,9 +285,9 @@ namespace triton {
         BvashrNode(AbstractNode* expr1, AbstractNode* expr2);
         BvashrNode(const BvashrNode& copy);
         virtual ~BvashrNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -190,9 +297,8 @@ namespace triton {
         BvdeclNode(triton::uint32 size);
         BvdeclNode(const BvdeclNode& copy);
         virtual ~BvdeclNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -202,9 +308,9 @@ namespace triton {
         BvlshrNode(AbstractNode* expr1, AbstractNode* expr2);
         BvlshrNode(const BvlshrNode& copy);
         virtual ~BvlshrNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -214,9 +320,9 @@ namespace triton {
         BvmulNode(AbstractNode* expr1, AbstractNode* expr2);
         BvmulNode(const BvmulNode& copy);
         virtual ~BvmulNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -226,9 +332,9 @@ namespace triton {
         BvnandNode(AbstractNode* expr1, AbstractNode* expr2);
         BvnandNode(const BvnandNode& copy);
         virtual ~BvnandNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -238,9 +344,9 @@ namespace triton {
         BvnegNode(AbstractNode* expr);
         BvnegNode(const BvnegNode& copy);
         virtual ~BvnegNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -250,9 +356,9 @@ namespace triton {
         BvnorNode(AbstractNode* expr1, AbstractNode* expr2);
         BvnorNode(const BvnorNode& copy);
         virtual ~BvnorNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -262,9 +368,9 @@ namespace triton {
         BvnotNode(AbstractNode* expr1);
         BvnotNode(const BvnotNode& copy);
         virtual ~BvnotNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -274,9 +380,9 @@ namespace triton {
         BvorNode(AbstractNode* expr1, AbstractNode* expr2);
         BvorNode(const BvorNode& copy);
         virtual ~BvorNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -287,9 +393,9 @@ namespace triton {
         BvrolNode(AbstractNode* rot, AbstractNode* expr);
         BvrolNode(const BvrolNode& copy);
         virtual ~BvrolNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -300,9 +406,9 @@ namespace triton {
         BvrorNode(AbstractNode* rot, AbstractNode* expr);
         BvrorNode(const BvrorNode& copy);
         virtual ~BvrorNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -312,9 +418,9 @@ namespace triton {
         BvsdivNode(AbstractNode* expr1, AbstractNode* expr2);
         BvsdivNode(const BvsdivNode& copy);
         virtual ~BvsdivNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -324,9 +430,9 @@ namespace triton {
         BvsgeNode(AbstractNode* expr1, AbstractNode* expr2);
         BvsgeNode(const BvsgeNode& copy);
         virtual ~BvsgeNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -336,9 +442,9 @@ namespace triton {
         BvsgtNode(AbstractNode* expr1, AbstractNode* expr2);
         BvsgtNode(const BvsgtNode& copy);
         virtual ~BvsgtNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -348,9 +454,9 @@ namespace triton {
         BvshlNode(AbstractNode* expr1, AbstractNode* expr2);
         BvshlNode(const BvshlNode& copy);
         virtual ~BvshlNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -360,9 +466,9 @@ namespace triton {
         BvsleNode(AbstractNode* expr1, AbstractNode* expr2);
         BvsleNode(const BvsleNode& copy);
         virtual ~BvsleNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -372,9 +478,9 @@ namespace triton {
         BvsltNode(AbstractNode* expr1, AbstractNode* expr2);
         BvsltNode(const BvsltNode& copy);
         virtual ~BvsltNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -384,9 +490,9 @@ namespace triton {
         BvsmodNode(AbstractNode* expr1, AbstractNode* expr2);
         BvsmodNode(const BvsmodNode& copy);
         virtual ~BvsmodNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -396,9 +502,9 @@ namespace triton {
         BvsremNode(AbstractNode* expr1, AbstractNode* expr2);
         BvsremNode(const BvsremNode& copy);
         virtual ~BvsremNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -408,9 +514,9 @@ namespace triton {
         BvsubNode(AbstractNode* expr1, AbstractNode* expr2);
         BvsubNode(const BvsubNode& copy);
         virtual ~BvsubNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -420,9 +526,9 @@ namespace triton {
         BvudivNode(AbstractNode* expr1, AbstractNode* expr2);
         BvudivNode(const BvudivNode& copy);
         virtual ~BvudivNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -432,9 +538,9 @@ namespace triton {
         BvugeNode(AbstractNode* expr1, AbstractNode* expr2);
         BvugeNode(const BvugeNode& copy);
         virtual ~BvugeNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -444,9 +550,9 @@ namespace triton {
         BvugtNode(AbstractNode* expr1, AbstractNode* expr2);
         BvugtNode(const BvugtNode& copy);
         virtual ~BvugtNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -456,9 +562,9 @@ namespace triton {
         BvuleNode(AbstractNode* expr1, AbstractNode* expr2);
         BvuleNode(const BvuleNode& copy);
         virtual ~BvuleNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -468,9 +574,9 @@ namespace triton {
         BvultNode(AbstractNode* expr1, AbstractNode* expr2);
         BvultNode(const BvultNode& copy);
         virtual ~BvultNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -480,9 +586,9 @@ namespace triton {
         BvuremNode(AbstractNode* expr1, AbstractNode* expr2);
         BvuremNode(const BvuremNode& copy);
         virtual ~BvuremNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -492,9 +598,9 @@ namespace triton {
         BvxnorNode(AbstractNode* expr1, AbstractNode* expr2);
         BvxnorNode(const BvxnorNode& copy);
         virtual ~BvxnorNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -504,9 +610,9 @@ namespace triton {
         BvxorNode(AbstractNode* expr1, AbstractNode* expr2);
         BvxorNode(const BvxorNode& copy);
         virtual ~BvxorNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -516,9 +622,9 @@ namespace triton {
         BvNode(triton::uint512 value, triton::uint32 size);
         BvNode(const BvNode& copy);
         virtual ~BvNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -528,9 +634,8 @@ namespace triton {
         CompoundNode(std::vector<AbstractNode*> exprs);
         CompoundNode(const CompoundNode& copy);
         virtual ~CompoundNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
     };
 
 
@@ -542,26 +647,32 @@ namespace triton {
         ConcatNode(std::list<AbstractNode* > exprs);
         ConcatNode(const ConcatNode& copy);
         virtual ~ConcatNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
     //! Decimal node
     class DecimalNode : public AbstractNode {
       protected:
-        triton::uint512 value;
+        //! The value if it fits in 64 bits.
+        triton::uint64 value;
+
+        //! The value if it does not fit in 64 bits, allocated out of line. nullptr otherwise.
+        triton::uint512* wideValue;
+
+        //! Sets the value.
+        void setValue(const triton::uint512& value);
 
       public:
         DecimalNode(triton::uint512 value);
         DecimalNode(const DecimalNode& copy);
         virtual ~DecimalNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
 
-        triton::uint512 getValue(void);
+        triton::uint512 getValue(void) const;
     };
 
 
@@ -571,9 +682,9 @@ namespace triton {
         DeclareFunctionNode(std::string name, AbstractNode* bvDecl);
         DeclareFunctionNode(const DeclareFunctionNode& copy);
         virtual ~DeclareFunctionNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -583,9 +694,9 @@ namespace triton {
         DistinctNode(AbstractNode* expr1, AbstractNode* expr2);
         DistinctNode(const DistinctNode& copy);
         virtual ~DistinctNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -595,9 +706,9 @@ namespace triton {
         EqualNode(AbstractNode* expr1, AbstractNode* expr2);
         EqualNode(const EqualNode& copy);
         virtual ~EqualNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -607,9 +718,9 @@ namespace triton {
         ExtractNode(triton::uint32 high, triton::uint32 low, AbstractNode* expr);
         ExtractNode(const ExtractNode& copy);
         virtual ~ExtractNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -619,9 +730,9 @@ namespace triton {
         IteNode(AbstractNode* ifExpr, AbstractNode* thenExpr, AbstractNode* elseExpr);
         IteNode(const IteNode& copy);
         virtual ~IteNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -631,9 +742,9 @@ namespace triton {
         LandNode(AbstractNode* expr1, AbstractNode* expr2);
         LandNode(const LandNode& copy);
         virtual ~LandNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -643,9 +754,9 @@ namespace triton {
         LetNode(std::string alias, AbstractNode* expr2, AbstractNode* expr3);
         LetNode(const LetNode& copy);
         virtual ~LetNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -655,9 +766,9 @@ namespace triton {
         LnotNode(AbstractNode* expr);
         LnotNode(const LnotNode& copy);
         virtual ~LnotNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -667,9 +778,9 @@ namespace triton {
         LorNode(AbstractNode* expr1, AbstractNode* expr2);
         LorNode(const LorNode& copy);
         virtual ~LorNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -682,11 +793,10 @@ namespace triton {
         ReferenceNode(triton::usize value);
         ReferenceNode(const ReferenceNode& copy);
         virtual ~ReferenceNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
 
-        triton::usize getValue(void);
+        triton::usize getValue(void) const;
     };
 
 
@@ -699,11 +809,10 @@ namespace triton {
         StringNode(std::string value);
         StringNode(const StringNode& copy);
         virtual ~StringNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
 
-        std::string getValue(void);
+        std::string getValue(void) const;
     };
 
 
@@ -713,9 +822,9 @@ namespace triton {
         SxNode(triton::uint32 sizeExt, AbstractNode* expr);
         SxNode(const SxNode& copy);
         virtual ~SxNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -728,11 +837,10 @@ namespace triton {
         VariableNode(triton::engines::symbolic::SymbolicVariable& symVar);
         VariableNode(const VariableNode& copy);
         virtual ~VariableNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
 
-        std::string getValue(void);
+        std::string getValue(void) const;
     };
 
 
@@ -742,9 +850,9 @@ namespace triton {
         ZxNode(triton::uint32 sizeExt, AbstractNode* expr);
         ZxNode(const ZxNode& copy);
         virtual ~ZxNode();
-        virtual void init(void);
+        virtual void initNode(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep) const;
+        virtual void computeEval(void) const;
     };
 
 
@@ -916,18 +1024,15 @@ namespace triton {
     //! AST C++ API - zx node builder
     AbstractNode* zx(triton::uint32 sizeExt, AbstractNode* expr);
 
-    //! AST C++ API - Duplicates the AST
-    AbstractNode* newInstance(AbstractNode* node);
-
-    //! Custom pow function for hash routine.
-    triton::uint512 pow(triton::uint512 hash, triton::uint32 n);
-
-    //! Custom rotate left function for hash routine.
-    triton::uint512 rotl(triton::uint512 value, triton::uint32 shift);
+    //! AST C++ API - Duplicates the AST. If `deep` is false, only the root is duplicated and the copy shares the childs of the original node.
+    AbstractNode* newInstance(AbstractNode* node, bool deep=true);
 
     //! Custom modular sign extend for bitwise operation.
     triton::sint512 modularSignExtend(AbstractNode* node);
 
+    //! Custom sign extend for bitwise operation on a node of 64 bits or fewer.
+    triton::sint64 nativeSignExtend(AbstractNode* node);
+
   /*! @} End of ast namespace */
   };
 /*! @} End of triton namespace */
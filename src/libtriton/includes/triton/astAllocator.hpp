@@ -0,0 +1,123 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTALLOCATOR_H
+#define TRITON_ASTALLOCATOR_H
+
+#include <map>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The granularity (and alignment) of the AST allocator size classes.
+    const triton::usize AST_ALLOCATOR_GRANULARITY = 16;
+
+    //! The biggest block served by a slab. Bigger blocks go to the global allocator.
+    const triton::usize AST_ALLOCATOR_MAX_SIZE = 512;
+
+    //! The size of a slab.
+    const triton::usize AST_ALLOCATOR_SLAB_SIZE = 64 * 1024;
+
+    //! The number of size classes.
+    const triton::usize AST_ALLOCATOR_CLASSES = AST_ALLOCATOR_MAX_SIZE / AST_ALLOCATOR_GRANULARITY + 1;
+
+    //! \class AstAllocator
+    /*! \brief The slab allocator of AST nodes.
+     *
+     * \description
+     * Every node kind has a fixed size, so each kind is served by its own size class. A size class
+     * carves slabs into blocks and keeps the free blocks in a free list, so allocating and freeing
+     * a node are O(1) and do not go through the global allocator. Slabs are released all at once
+     * when no node is alive anymore (See: triton::ast::AstGarbageCollector::freeAllAstNodes()).
+     */
+    class AstAllocator {
+      private:
+        //! The free blocks of each size class, linked through their first word.
+        void* freeLists[AST_ALLOCATOR_CLASSES];
+
+        //! The slabs and their size class (slab address -> size class).
+        std::map<triton::uint8*, triton::usize> slabs;
+
+        //! The number of blocks currently allocated (nodes and out of line storage).
+        triton::usize liveBlocks;
+
+        //! The memory of the blocks currently allocated in bytes.
+        triton::usize liveMemory;
+
+        //! The number of out of line blocks currently allocated (See: allocateOutOfLine()).
+        triton::usize outOfLineBlocks;
+
+        //! The memory of the out of line blocks currently allocated in bytes.
+        triton::usize outOfLineMemory;
+
+        //! Constructor.
+        AstAllocator();
+
+        //! Adds a new slab to a size class. Returns false if there is not enough memory.
+        bool grow(triton::usize sizeClass);
+
+      public:
+        //! Returns the allocator of the AST nodes. It is never destroyed, nodes may be freed at exit.
+        static AstAllocator& getInstance(void);
+
+        //! Allocates a block of `size` bytes. Returns nullptr if there is not enough memory.
+        void* allocate(triton::usize size);
+
+        //! Frees a block of `size` bytes.
+        void deallocate(void* ptr, triton::usize size);
+
+        //! Frees a block whose size is unknown (slower, used when a node constructor throws).
+        void deallocate(void* ptr);
+
+        //! Allocates the out of line storage of a node (childs, parents or value which do not fit in the node).
+        void* allocateOutOfLine(triton::usize size);
+
+        //! Frees the out of line storage of a node.
+        void deallocateOutOfLine(void* ptr, triton::usize size);
+
+        //! Releases all slabs if no block is alive anymore.
+        void release(void);
+
+        //! Returns the number of blocks currently allocated.
+        triton::usize getLiveBlocks(void) const;
+
+        //! Returns the memory of the blocks currently allocated in bytes.
+        triton::usize getLiveMemory(void) const;
+
+        //! Returns the number of out of line blocks currently allocated.
+        triton::usize getOutOfLineBlocks(void) const;
+
+        //! Returns the memory of the out of line blocks currently allocated in bytes.
+        triton::usize getOutOfLineMemory(void) const;
+
+        //! Returns the memory reserved by the slabs in bytes.
+        triton::usize getReservedMemory(void) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTALLOCATOR_H */
@@ -8,7 +8,8 @@
 #ifndef TRITON_ASTDICTIONARIES_H
 #define TRITON_ASTDICTIONARIES_H
 
-#include <set>
+#include <map>
+#include <string>
 #include <vector>
 
 #include <triton/ast.hpp>
@@ -32,172 +33,57 @@ namespace triton {
    */
 
     //! \class AstDictionaries
-    /*! \brief The AST dictionaries class */
+    /*! \brief The AST dictionaries class
+     *
+     * \description
+     * Nodes are hash-consed: structurally equal nodes share a single canonical node. Two nodes are
+     * equal if they have the same kind, the same size, the same children (by address) and the same
+     * immediate payload (decimal value, reference id, string or variable name).
+     *
+     * The dictionaries do not own the canonical nodes (See: triton::ast::AstGarbageCollector) but hold
+     * a reference on each one. A canonical node is removed from the dictionaries when it is freed.
+     */
     class AstDictionaries {
-      private:
-        //! Defines if this instance is used as a backup.
-        bool backupFlag;
-
       protected:
         //! Total of allocated nodes.
         triton::usize allocatedNodes;
 
-        //! Total of allocated dictionaries.
-        std::set<triton::ast::AbstractNode*> allocatedDictionaries;
-
-        //! Assert Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> assertDictionary;
-
-        //! Bvadd Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvaddDictionary;
-
-        //! Bvand Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvandDictionary;
-
-        //! Bvashr Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvashrDictionary;
-
-        //! Bvdecl Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvdeclDictionary;
-
-        //! Bvlshr Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvlshrDictionary;
-
-        //! Bvmul Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvmulDictionary;
-
-        //! Bvnand Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnandDictionary;
-
-        //! Bvneg Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnegDictionary;
-
-        //! Bvnor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnorDictionary;
-
-        //! Bvnot Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnotDictionary;
-
-        //! Bvor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvorDictionary;
-
-        //! Bvrol Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvrolDictionary;
-
-        //! Bvror Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvrorDictionary;
-
-        //! Bvsdiv Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsdivDictionary;
-
-        //! Bvsge Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsgeDictionary;
-
-        //! Bvsgt Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsgtDictionary;
-
-        //! Bvshl Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvshlDictionary;
-
-        //! Bvsle Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsleDictionary;
-
-        //! Bvslt Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsltDictionary;
-
-        //! Bvsmod Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsmodDictionary;
-
-        //! Bvsrem Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsremDictionary;
+        //! Number of canonical nodes in the table.
+        triton::usize indexedNodes;
 
-        //! Bvsub Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsubDictionary;
+        //! Number of slots of the table whose node has been removed.
+        triton::usize removedSlots;
 
-        //! Bvudiv Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvudivDictionary;
+        //! The hash-consing table (open addressing with linear probing). An empty slot is null, a removed one is a tombstone.
+        std::vector<triton::ast::AbstractNode*> table;
 
-        //! Bvuge Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvugeDictionary;
+        //! The hash of each slot of the table.
+        std::vector<triton::uint64> hashes;
 
-        //! Bvugt Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvugtDictionary;
+        //! Number of unique nodes per kind.
+        std::map<triton::uint32, triton::usize> uniqueNodes;
 
-        //! Bvule Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvuleDictionary;
+        //! Returns the hash of a node in the table.
+        triton::uint64 hash(triton::ast::AbstractNode* node) const;
 
-        //! Bvult Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvultDictionary;
+        //! Returns true if two nodes are structurally equal. Children are compared by address.
+        bool isEqual(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) const;
 
-        //! Bvurem Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvuremDictionary;
+        //! Returns the slot of a canonical node, or the size of the table if the node is not in the table.
+        triton::usize find(triton::ast::AbstractNode* node) const;
 
-        //! Bvxnor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvxnorDictionary;
+        //! Inserts a node into the table without looking for an equal one.
+        void insert(triton::ast::AbstractNode* node, triton::uint64 hash);
 
-        //! Bvxor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvxorDictionary;
+        //! Rebuilds the table with `capacity` slots and without its tombstones.
+        void rehash(triton::usize capacity);
 
-        //! Bv Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvDictionary;
-
-        //! Compound Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> compoundDictionary;
-
-        //! Concat Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> concatDictionary;
-
-        //! Decimal Dictionary
-        std::map<triton::uint512, triton::ast::AbstractNode*> decimalDictionary;
-
-        //! Declare Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> declareFunctionDictionary;
-
-        //! Distinct Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> distinctDictionary;
-
-        //! Equal Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> equalDictionary;
-
-        //! Extract Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> extractDictionary;
-
-        //! Ite Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> iteDictionary;
-
-        //! Land Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> landDictionary;
-
-        //! Let Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> letDictionary;
-
-        //! Lnot Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> lnotDictionary;
-
-        //! Lor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> lorDictionary;
-
-        //! Reference Dictionary
-        std::map<triton::usize, triton::ast::AbstractNode*> referenceDictionary;
-
-        //! String Dictionary
-        std::map<std::string, triton::ast::AbstractNode*> stringDictionary;
-
-        //! Sx Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> sxDictionary;
-
-        //! Variable Dictionary
-        std::map<std::string, triton::ast::AbstractNode*> variableDictionary;
-
-        //! Zx Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> zxDictionary;
-
-        //! Dictionaries
-        std::map<triton::uint32, void*> dictionaries;
+        //! Returns the number of unique nodes of a kind.
+        triton::usize getUniqueNodes(triton::uint32 kind) const;
 
     public:
         //! Constructor.
-        AstDictionaries(bool isBackup=false);
+        AstDictionaries();
 
         //! Constructor.
         AstDictionaries(const AstDictionaries& copy);
@@ -211,12 +97,18 @@ namespace triton {
         //! Copies an AstDictionaries.
         void copy(const AstDictionaries& other);
 
-        //! Links all sub dictionaries to the root one.
-        void linkDictionaries(void);
-
-        //! Browses into dictionaries.
+        //! Browses into dictionaries. Returns the canonical node equal to `node` or null if `node` is new and becomes canonical.
         triton::ast::AbstractNode* browseAstDictionaries(triton::ast::AbstractNode* node);
 
+        //! Returns true if the node is a canonical node of the dictionaries.
+        bool isIndexed(triton::ast::AbstractNode* node) const;
+
+        //! Removes a canonical node from the dictionaries, which release their reference on it. Returns false if the node is not in the dictionaries.
+        bool unindexAstNode(triton::ast::AbstractNode* node);
+
+        //! Removes all nodes from the dictionaries, without releasing their references.
+        void clearAstDictionaries(void);
+
         //! Returns stats about dictionaries.
         std::map<std::string, triton::usize> getAstDictionariesStats(void) const;
     };
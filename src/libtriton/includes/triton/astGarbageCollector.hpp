@@ -10,6 +10,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/astDictionaries.hpp>
@@ -44,8 +45,26 @@ namespace triton {
         bool backupFlag;
 
       protected:
-        //! This container contains all allocated nodes.
-        std::set<triton::ast::AbstractNode*> allocatedNodes;
+        /*!
+         * \brief This container contains all allocated nodes, in the order they were recorded.
+         *
+         * \description
+         * Each node knows its position in the container (See: triton::ast::AbstractNode::getRecordIndex()),
+         * so recording and freeing a node are O(1) and neither allocate nor hash.
+         */
+        std::vector<triton::ast::AbstractNode*> allocatedNodes;
+
+        //! Returns true if nothing but the dictionaries references the node.
+        bool isUnreferenced(triton::ast::AbstractNode* node) const;
+
+        //! Returns true if the node is recorded by this instance.
+        bool isRecorded(triton::ast::AbstractNode* node) const;
+
+        //! Removes a node from the recorded nodes by moving the last one into its place. Returns false if the node was not recorded.
+        bool unrecordAstNode(triton::ast::AbstractNode* node);
+
+        //! Replaces the recorded nodes by `nodes` and frees the nodes which are not part of them.
+        void assignAllocatedAstNodes(const std::vector<triton::ast::AbstractNode*>& nodes);
 
         //! This map maintains a link between symbolic variables and their nodes.
         std::map<std::string, triton::ast::AbstractNode*> variableNodes;
@@ -66,12 +85,15 @@ namespace triton {
         //! Copies an AstGarbageCollectors..
         void copy(const AstGarbageCollector& other);
 
-        //! Go through every allocated nodes and free them.
+        //! Go through every allocated nodes and free them. Slabs are released in bulk if no node is alive anymore.
         void freeAllAstNodes(void);
 
         //! Frees a set of nodes and removes them from the global container.
         void freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes);
 
+        //! Frees the nodes which are not referenced anymore, starting from `roots`, and the childs they were the last reference to. Costs O(freed nodes).
+        void freeUnreferencedAstNodes(std::vector<triton::ast::AbstractNode*>& roots);
+
         //! Extracts all unique nodes from a partial AST into the uniqueNodes set.
         void extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const;
 
@@ -82,7 +104,10 @@ namespace triton {
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
         //! Returns all allocated nodes.
-        const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
+        const std::vector<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
+
+        //! Returns the memory used by the live nodes (See: triton::ast::AstAllocator).
+        std::map<std::string, triton::usize> getAstMemoryStats(void) const;
 
         //! Returns all variable nodes recorded.
         const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
@@ -91,7 +116,7 @@ namespace triton {
         triton::ast::AbstractNode* getAstVariableNode(const std::string& name) const;
 
         //! Sets all allocated nodes.
-        void setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes);
+        void setAllocatedAstNodes(const std::vector<triton::ast::AbstractNode*>& nodes);
 
         //! Sets all variable nodes recorded.
         void setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes);
@@ -37,8 +37,17 @@ namespace triton {
      *  @{
      */
 
-      //! Python representation.
+      /*! \class AstPythonRepresentation
+       *  \brief Python representation.
+       *
+       * \description
+       * A node is printed part by part with triton::ast::inOrderWalk(), nothing is recursive.
+       */
       class AstPythonRepresentation : public AstRepresentationInterface {
+        private:
+          //! Prints the part `part` of a node and returns the child printed after it, nullptr once the node is printed.
+          triton::ast::AbstractNode* printPart(std::ostream& stream, triton::ast::AbstractNode* node, triton::usize part) const;
+
         public:
           //! Constructor.
           AstPythonRepresentation();
@@ -48,153 +57,6 @@ namespace triton {
 
           //! Displays the node according to the representation mode.
           std::ostream& print(std::ostream& stream, triton::ast::AbstractNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::AssertNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvaddNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvandNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvashrNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvdeclNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvlshrNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvmulNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvnandNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvnegNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvnorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvnotNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvrolNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvrorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsdivNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsgeNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsgtNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvshlNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsleNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsltNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsmodNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsremNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsubNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvudivNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvugeNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvugtNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvuleNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvultNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvuremNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvxnorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvxorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::CompoundNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::ConcatNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::DecimalNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::DeclareFunctionNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::DistinctNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::EqualNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::ExtractNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::IteNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::LandNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::LetNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::LnotNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::LorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::ReferenceNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::StringNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::SxNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::VariableNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::ZxNode* node);
       };
 
 
@@ -12,6 +12,7 @@
 
 #include <triton/astPythonRepresentation.hpp>
 #include <triton/astRepresentationInterface.hpp>
+#include <triton/astSmtDagRepresentation.hpp>
 #include <triton/astSmtRepresentation.hpp>
 #include <triton/ast.hpp>
 
@@ -43,6 +44,7 @@ namespace triton {
       enum mode_e {
         SMT_REPRESENTATION,     /*!< SMT representation */
         PYTHON_REPRESENTATION,  /*!< Python representation */
+        SMT_DAG_REPRESENTATION, /*!< SMT representation with let-bindings for the shared nodes */
         LAST_REPRESENTATION
       };
 
@@ -0,0 +1,227 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTSMALLVECTOR_H
+#define TRITON_ASTSMALLVECTOR_H
+
+#include <cstring>
+#include <new>
+
+#include <triton/astAllocator.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class SmallVector
+    /*! \brief A vector which keeps its first `N` items inline.
+     *
+     * \description
+     * The childs and the parents of most AST nodes fit in a few pointers, so the items are stored
+     * in the vector itself until there are more than `N` of them. Bigger vectors move their items
+     * out of line, in a block taken from the AST allocator (See: triton::ast::AstAllocator). `T`
+     * must be trivially copyable, items are moved with `memcpy`.
+     */
+    template <typename T, triton::uint32 N>
+    class SmallVector {
+      private:
+        //! The items, inline if the capacity is `N`, out of line otherwise.
+        union {
+          T inlineItems[N];
+          T* outOfLineItems;
+        };
+
+        //! The number of items.
+        triton::uint32 count;
+
+        //! The number of items which fit without growing.
+        triton::uint32 capacity;
+
+        //! Returns the items.
+        T* items(void) {
+          return (this->capacity > N) ? this->outOfLineItems : this->inlineItems;
+        }
+
+        //! Returns the items.
+        const T* items(void) const {
+          return (this->capacity > N) ? this->outOfLineItems : this->inlineItems;
+        }
+
+        //! Gives the out of line items back to the AST allocator and comes back to the inline storage.
+        void release(void) {
+          if (this->capacity > N)
+            triton::ast::AstAllocator::getInstance().deallocateOutOfLine(this->outOfLineItems, this->capacity * sizeof(T));
+          this->capacity = N;
+        }
+
+      public:
+        //! Constructor.
+        SmallVector() {
+          this->count    = 0;
+          this->capacity = N;
+        }
+
+        //! Constructor by copy.
+        SmallVector(const SmallVector& copy) {
+          this->count    = 0;
+          this->capacity = N;
+          this->operator=(copy);
+        }
+
+        //! Destructor.
+        ~SmallVector() {
+          this->release();
+        }
+
+        //! Copies another vector.
+        SmallVector& operator=(const SmallVector& other) {
+          if (this == &other)
+            return *this;
+          this->count = 0;
+          this->reserve(other.count);
+          std::memcpy(this->items(), other.items(), other.count * sizeof(T));
+          this->count = other.count;
+          return *this;
+        }
+
+        //! Returns true if both vectors contain the same items in the same order.
+        bool operator==(const SmallVector& other) const {
+          if (this->count != other.count)
+            return false;
+          for (triton::uint32 index = 0; index < this->count; index++) {
+            if (this->items()[index] != other.items()[index])
+              return false;
+          }
+          return true;
+        }
+
+        //! Returns true if the vectors differ.
+        bool operator!=(const SmallVector& other) const {
+          return !(*this == other);
+        }
+
+        //! Returns an item.
+        T& operator[](triton::uint32 index) {
+          return this->items()[index];
+        }
+
+        //! Returns an item.
+        const T& operator[](triton::uint32 index) const {
+          return this->items()[index];
+        }
+
+        //! Returns the number of items.
+        triton::uint32 size(void) const {
+          return this->count;
+        }
+
+        //! Returns true if there is no item.
+        bool empty(void) const {
+          return this->count == 0;
+        }
+
+        //! Returns the first item.
+        T* begin(void) {
+          return this->items();
+        }
+
+        //! Returns the first item.
+        const T* begin(void) const {
+          return this->items();
+        }
+
+        //! Returns the end of the items.
+        T* end(void) {
+          return this->items() + this->count;
+        }
+
+        //! Returns the end of the items.
+        const T* end(void) const {
+          return this->items() + this->count;
+        }
+
+        //! Returns the last item.
+        T& back(void) {
+          return this->items()[this->count - 1];
+        }
+
+        //! Makes room for `n` items. The capacity is doubled to keep push_back() amortized O(1).
+        void reserve(triton::uint32 n) {
+          if (n <= this->capacity)
+            return;
+
+          triton::uint32 newCapacity = this->capacity * 2;
+          if (newCapacity < n)
+            newCapacity = n;
+
+          T* newItems = static_cast<T*>(triton::ast::AstAllocator::getInstance().allocateOutOfLine(newCapacity * sizeof(T)));
+          if (newItems == nullptr)
+            throw std::bad_alloc();
+
+          std::memcpy(newItems, this->items(), this->count * sizeof(T));
+          this->release();
+          this->outOfLineItems = newItems;
+          this->capacity       = newCapacity;
+        }
+
+        //! Adds an item at the end.
+        void push_back(const T& item) {
+          this->reserve(this->count + 1);
+          this->items()[this->count++] = item;
+        }
+
+        //! Removes the last item.
+        void pop_back(void) {
+          this->count--;
+        }
+
+        //! Inserts an item before `pos` and returns its position.
+        T* insert(T* pos, const T& item) {
+          triton::uint32 index = static_cast<triton::uint32>(pos - this->begin());
+          this->reserve(this->count + 1);
+          T* base = this->items();
+          std::memmove(base + index + 1, base + index, (this->count - index) * sizeof(T));
+          base[index] = item;
+          this->count++;
+          return base + index;
+        }
+
+        //! Removes the item at `pos`.
+        void erase(T* pos) {
+          T* base = this->items();
+          triton::uint32 index = static_cast<triton::uint32>(pos - base);
+          std::memmove(base + index, base + index + 1, (this->count - index - 1) * sizeof(T));
+          this->count--;
+        }
+
+        //! Removes all items and gives the out of line items back.
+        void clear(void) {
+          this->release();
+          this->count = 0;
+        }
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTSMALLVECTOR_H */
@@ -0,0 +1,82 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTSMTDAGREPRESENTATION_HPP
+#define TRITON_ASTSMTDAGREPRESENTATION_HPP
+
+#include <iostream>
+#include <unordered_map>
+
+#include <triton/astRepresentationInterface.hpp>
+#include <triton/astSmtRepresentation.hpp>
+#include <triton/ast.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The Representations namespace
+    namespace representations {
+    /*!
+     *  \ingroup ast
+     *  \addtogroup representations
+     *  @{
+     */
+
+      /*! \class AstSmtDagRepresentation
+       *  \brief SMT representation which prints each shared node once.
+       *
+       * \description
+       * The syntax is the one of triton::ast::representations::AstSmtRepresentation, but a node used
+       * more than once is bound by a `let` to a name like `dag!0` and this name is printed instead of
+       * the node. The text grows with the number of nodes of the DAG instead of the size of the
+       * expanded tree. Nodes are streamed as they are walked and the only state kept is the name of
+       * each shared node, nothing is recursive.
+       */
+      class AstSmtDagRepresentation : public AstRepresentationInterface {
+        private:
+          //! Prints the parts of the nodes.
+          AstSmtRepresentation smt;
+
+          //! Prints `root`, where the shared nodes already bound are replaced by their names.
+          void printTerm(std::ostream& stream, triton::ast::AbstractNode* root, const std::unordered_map<triton::ast::AbstractNode*, triton::usize>& names);
+
+          //! Prints a term with the let-bindings of its shared nodes.
+          void printDag(std::ostream& stream, triton::ast::AbstractNode* root);
+
+        public:
+          //! Constructor.
+          AstSmtDagRepresentation();
+
+          //! Destructor.
+          virtual ~AstSmtDagRepresentation();
+
+          //! Displays the node according to the representation mode.
+          std::ostream& print(std::ostream& stream, triton::ast::AbstractNode* node);
+      };
+
+    /*! @} End of representations namespace */
+    };
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTSMTDAGREPRESENTATION_HPP */
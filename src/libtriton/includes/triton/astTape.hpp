@@ -0,0 +1,161 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTTAPE_H
+#define TRITON_ASTTAPE_H
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class AstTape
+    /*! \brief An AST compiled for repeated evaluations.
+     *
+     * \description
+     * The nodes of the AST are flattened in post-order into a list of instructions. References
+     * are followed, shared sub-trees are compiled once and the sub-trees without symbolic variable
+     * are folded into constants. Each instruction writes a register: a 64-bit one if its node has
+     * 64 bits or fewer, a wide one otherwise. evaluate() then runs the instructions with the values
+     * given to the symbolic variables. It neither touches the AST nor the API, and it does not
+     * allocate. evaluateBatch() runs each instruction over a block of evaluations at once when all
+     * the registers have 64 bits or fewer, so that the compiler turns these loops into SIMD code.
+     */
+    class AstTape {
+      public:
+        //! A register of the tape. `index` is in the 64-bit registers if `size` is 64 or fewer, in the wide ones otherwise.
+        struct Operand {
+          triton::uint32 index;
+          triton::uint32 size;
+        };
+
+        //! An instruction of the tape. Computes a node of kind `kind` and writes it into `destination`. Unused operands are the destination.
+        struct Instruction {
+          triton::ast::kind_e kind;
+          bool native;
+          triton::uint32 immediate;
+          Operand destination;
+          Operand operands[3];
+        };
+
+      private:
+        //! The instructions, in post-order.
+        std::vector<Instruction> instructions;
+
+        //! The 64-bit registers.
+        std::vector<triton::uint64> natives;
+
+        //! The wide registers.
+        std::vector<triton::uint512> wides;
+
+        //! The ids of the symbolic variables, in the order of the values given to evaluate().
+        std::vector<triton::usize> variables;
+
+        //! The registers of the symbolic variables.
+        std::vector<Operand> inputs;
+
+        //! The 64-bit registers of evaluateBatch(), one block of lanes per register.
+        std::vector<triton::uint64> lanes;
+
+        //! The register of the root.
+        Operand output;
+
+        //! Compiles the tree of `root`.
+        void compile(triton::ast::AbstractNode* root, triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+
+        /*!
+         * \brief Compiles the tree of `root`, where the names of `bindings` are the values bound by the enclosing lets.
+         *
+         * \description
+         * Returns the register of `root` and true if it depends on a symbolic variable. `inputsIndex` maps the id of
+         * each symbolic variable already compiled to its index in the inputs. The body of a let is compiled by another
+         * call, as a name may not have the same value inside and outside of it.
+         */
+        std::pair<Operand, bool> compileTree(triton::ast::AbstractNode* root,
+                                             triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                             const std::map<std::string, std::pair<Operand, bool>>& bindings,
+                                             std::unordered_map<triton::usize, triton::uint32>& inputsIndex);
+
+        //! Allocates a register.
+        Operand newRegister(triton::uint32 size);
+
+        //! Runs an instruction.
+        void execute(const Instruction& inst);
+
+        //! Runs an instruction whose result and operands have 64 bits or fewer.
+        void executeNative(const Instruction& inst);
+
+        //! Runs an instruction with wide values.
+        void executeWide(const Instruction& inst);
+
+        //! Runs a native instruction on each lane of evaluateBatch().
+        void executeLanes(const Instruction& inst);
+
+        //! Returns true if the instructions, the inputs and the output only use 64-bit registers.
+        bool isNative(void) const;
+
+        //! Returns the value of a register.
+        triton::uint64 getNative(const Operand& op) const;
+
+        //! Returns the value of a register.
+        triton::uint512 getWide(const Operand& op) const;
+
+        //! Writes a register.
+        void setNative(const Operand& op, triton::uint64 value);
+
+        //! Writes a register.
+        void setWide(const Operand& op, const triton::uint512& value);
+
+      public:
+        //! Constructor. Compiles `node`. References are followed with `symbolicEngine`.
+        AstTape(triton::ast::AbstractNode* node, triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+
+        //! Returns the ids of the symbolic variables, in the order of the values given to evaluate().
+        const std::vector<triton::usize>& getVariables(void) const;
+
+        //! Returns the number of instructions.
+        triton::usize getNumberOfInstructions(void) const;
+
+        //! Returns the size of the compiled node.
+        triton::uint32 getBitvectorSize(void) const;
+
+        //! Evaluates the compiled node. `values` are the values of the symbolic variables, in the order of getVariables().
+        triton::uint512 evaluate(const std::vector<triton::uint512>& values);
+
+        //! Evaluates the compiled node once per element of `values`. Each element is given as to evaluate().
+        std::vector<triton::uint512> evaluateBatch(const std::vector<std::vector<triton::uint512>>& values);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTTAPE_H */
@@ -0,0 +1,129 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTWALKER_H
+#define TRITON_ASTWALKER_H
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \brief Walks a DAG from `root` in pre-order with an explicit stack.
+     *
+     * \description
+     * `expand(node, successors)` is called when a node is reached. It appends the successors to walk
+     * next and returns false if the node must not be walked (e.g. it has already been visited). The
+     * successors are walked in the order they are appended. Nothing is recursive, so the depth of the
+     * DAG is only bounded by the memory.
+     */
+    template <typename Node, typename Expand>
+    void preOrderWalk(const Node& root, Expand expand) {
+      std::vector<Node> pending;
+
+      pending.push_back(root);
+      while (!pending.empty()) {
+        Node node = pending.back();
+        pending.pop_back();
+
+        triton::usize base = pending.size();
+        if (!expand(node, pending))
+          pending.erase(pending.begin() + base, pending.end());
+        std::reverse(pending.begin() + base, pending.end());
+      }
+    }
+
+
+    /*! \brief Walks a DAG from `root` in post-order with an explicit stack.
+     *
+     * \description
+     * `expand(node, successors)` is called when a node is reached, as for triton::ast::preOrderWalk().
+     * `visit(node)` is called once all the successors of the node have been visited, so a pass which
+     * caches its results per node finds the results of the successors in its cache. Nothing is
+     * recursive, so the depth of the DAG is only bounded by the memory.
+     */
+    template <typename Node, typename Expand, typename Visit>
+    void postOrderWalk(const Node& root, Expand expand, Visit visit) {
+      /* The successors not walked yet and, per node on the path, where its successors start */
+      std::vector<Node> pending;
+      std::vector<std::pair<Node, triton::usize>> path;
+
+      if (!expand(root, pending))
+        return;
+      std::reverse(pending.begin(), pending.end());
+      path.push_back(std::make_pair(root, 0));
+
+      while (!path.empty()) {
+        /* All the successors of the last node have been visited */
+        if (pending.size() == path.back().second) {
+          Node node = path.back().first;
+          path.pop_back();
+          visit(node);
+          continue;
+        }
+
+        Node node = pending.back();
+        pending.pop_back();
+
+        triton::usize base = pending.size();
+        if (!expand(node, pending)) {
+          pending.erase(pending.begin() + base, pending.end());
+          continue;
+        }
+        std::reverse(pending.begin() + base, pending.end());
+        path.push_back(std::make_pair(node, base));
+      }
+    }
+
+    /*! \brief Walks a tree from `root` in order with an explicit stack.
+     *
+     * \description
+     * `part(node, index)` is called for the parts 0, 1, 2... of a node until it returns a null node. Each
+     * part returns the successor to walk before the next part of the node, so a printer prints the text
+     * which precedes a child and returns the child, in any order and as many times as needed. A shared
+     * successor is walked each time it is returned. Nothing is recursive, so the depth of the tree is only
+     * bounded by the memory.
+     */
+    template <typename Node, typename Part>
+    void inOrderWalk(const Node& root, Part part) {
+      /* The nodes on the path and the index of their next part */
+      std::vector<std::pair<Node, triton::usize>> path;
+
+      path.push_back(std::make_pair(root, 0));
+      while (!path.empty()) {
+        Node successor = part(path.back().first, path.back().second++);
+        if (successor)
+          path.push_back(std::make_pair(successor, 0));
+        else
+          path.pop_back();
+      }
+    }
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTWALKER_H */
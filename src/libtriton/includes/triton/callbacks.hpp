@@ -9,8 +9,12 @@
 #define TRITON_CALLBACKS_H
 
 #include <list>
+#include <map>
+#include <set>
+#include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
 #include <triton/tritonTypes.hpp>
@@ -70,8 +74,29 @@ namespace triton {
         //! [c++] Callbacks for all concrete register needs.
         std::list<triton::callbacks::getConcreteRegisterValueCallback> getConcreteRegisterValueCallbacks;
 
-        //! [c++] Callbacks for all symbolic simplifications.
-        std::list<triton::callbacks::symbolicSimplificationCallback> symbolicSimplificationCallbacks;
+        //! A SYMBOLIC_SIMPLIFICATION callback and the roots it is called on.
+        struct SymbolicSimplificationEntry {
+          //! The callback.
+          triton::callbacks::symbolicSimplificationCallback callback;
+
+          //! The kinds of root. Empty for all kinds.
+          std::set<triton::ast::kind_e> kinds;
+
+          //! The minimum size of the root.
+          triton::uint32 minSize;
+        };
+
+        //! [c++] Callbacks for all symbolic simplifications, in the order they were added.
+        std::vector<SymbolicSimplificationEntry> symbolicSimplificationCallbacks;
+
+        //! The indexes of the symbolic simplification callbacks called on each kind of root, in ascending order.
+        std::map<triton::ast::kind_e, std::vector<triton::usize>> symbolicSimplificationTable;
+
+        //! The indexes of the symbolic simplification callbacks called on any kind of root, in ascending order.
+        std::vector<triton::usize> symbolicSimplificationAnyKind;
+
+        //! Rebuilds the dispatch table of the symbolic simplification callbacks.
+        void updateSymbolicSimplificationTable(void);
 
         //! Returns the number of callbacks recorded.
         triton::usize countCallbacks(void) const;
@@ -101,6 +126,9 @@ namespace triton {
         //! Adds a SYMBOLIC_SIMPLIFICATION callback.
         void addCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! Adds a SYMBOLIC_SIMPLIFICATION callback only called on the roots of kind `kinds` (all kinds if empty) and of `minSize` bits or more.
+        void addCallback(triton::callbacks::symbolicSimplificationCallback cb, const std::set<triton::ast::kind_e>& kinds, triton::uint32 minSize=0);
+
         //! Removes all recorded callbacks.
         void removeAllCallbacks(void);
 
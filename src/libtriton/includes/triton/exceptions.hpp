@@ -179,6 +179,30 @@ namespace triton {
     };
 
 
+    /*! \class SolverSession
+     *  \brief The exception class used by the solver session. */
+    class SolverSession : public triton::exceptions::SolverEngine {
+      public:
+        //! Constructor.
+        SolverSession(const char* message) : triton::exceptions::SolverEngine(message) {};
+
+        //! Constructor.
+        SolverSession(const std::string& message) : triton::exceptions::SolverEngine(message) {};
+    };
+
+
+    /*! \class SolverCache
+     *  \brief The exception class used by the solver cache. */
+    class SolverCache : public triton::exceptions::SolverEngine {
+      public:
+        //! Constructor.
+        SolverCache(const char* message) : triton::exceptions::SolverEngine(message) {};
+
+        //! Constructor.
+        SolverCache(const std::string& message) : triton::exceptions::SolverEngine(message) {};
+    };
+
+
     /*! \class API
      *  \brief The exception class used by the Triton's API. */
     class API : public triton::exceptions::Exception {
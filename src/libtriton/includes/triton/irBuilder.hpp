@@ -57,8 +57,8 @@ namespace triton {
         //! Taint engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
-        //! Removes all symbolic expressions of an instruction.
-        void removeSymbolicExpressions(triton::arch::Instruction& inst, std::set<triton::ast::AbstractNode*>& uniqueNodes);
+        //! Removes all symbolic expressions of an instruction and collects their ASTs into unusedNodes.
+        void removeSymbolicExpressions(triton::arch::Instruction& inst, std::vector<triton::ast::AbstractNode*>& unusedNodes);
 
       protected:
         //! x86 ISA builder.
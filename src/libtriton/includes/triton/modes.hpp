@@ -37,6 +37,9 @@ namespace triton {
       ONLY_ON_SYMBOLIZED,    //!< [symbolic mode] Perform symbolic execution only on symbolized expressions.
       ONLY_ON_TAINTED,       //!< [symbolic mode] Perform symbolic execution only on tainted instructions.
       PC_TRACKING_SYMBOLIC,  //!< [symbolic mode] Track path constraints only if they are symbolized.
+
+      /* Solver */
+      PC_SLICING,            //!< [solver mode] Send to the solver only the path constraints which share symbolic variables with the query.
     };
 
 
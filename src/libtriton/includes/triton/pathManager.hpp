@@ -48,10 +48,22 @@ namespace triton {
           //! Modes API.
           triton::modes::Modes* modes;
 
+          //! The last generation given to a path constraint, by any path manager.
+          static triton::usize lastGeneration;
+
         protected:
           //! \brief The logical conjunction vector of path constraints.
           std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
 
+          /*! \brief The generation of each path constraint.
+           *
+           * \description
+           * Each added path constraint gets a new generation, so two path managers which have the
+           * same generation at an index have the same path constraints up to this index, even if
+           * one of them has been rewound by a copy meanwhile.
+           */
+          std::vector<triton::usize> generations;
+
         public:
           //! Constructor.
           PathManager(triton::modes::Modes* modes);
@@ -74,6 +86,9 @@ namespace triton {
           //! Returns the number of constraints.
           triton::usize getNumberOfPathConstraints(void) const;
 
+          //! Returns the generation of the path constraint at `index`.
+          triton::usize getPathConstraintGeneration(triton::usize index) const;
+
           //! Adds a path constraint.
           void addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr);
 
@@ -111,6 +111,9 @@ namespace triton {
       //! Initializes the MODE python namespace.
       void initModeNamespace(PyObject* modeDict);
 
+      //! Initializes the SOLVER python namespace.
+      void initSolverNamespace(PyObject* solverDict);
+
       //! Initializes the SYMEXPR python namespace.
       void initSymExprNamespace(PyObject* symExprDict);
 
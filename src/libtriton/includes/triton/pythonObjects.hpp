@@ -10,6 +10,7 @@
 #define TRITON_PYOBJECT_H
 
 #include <triton/ast.hpp>
+#include <triton/astTape.hpp>
 #include <triton/bitsVector.hpp>
 #include <triton/elf.hpp>
 #include <triton/elfDynamicTable.hpp>
@@ -58,6 +59,9 @@ namespace triton {
       //! Creates the AstNode python class.
       PyObject* PyAstNode(triton::ast::AbstractNode* node);
 
+      //! Creates the AstTape python class.
+      PyObject* PyAstTape(const triton::ast::AstTape& tape);
+
       //! Creates the Bitvector python class.
       PyObject* PyBitvector(const triton::arch::Immediate& imm);
 
@@ -159,6 +163,17 @@ namespace triton {
       //! pyAstNode type.
       extern PyTypeObject AstNode_Type;
 
+      /* AstTape ======================================================== */
+
+      //! pyAstTape object.
+      typedef struct {
+        PyObject_HEAD
+        triton::ast::AstTape* tape;
+      } AstTape_Object;
+
+      //! pyAstTape type.
+      extern PyTypeObject AstTape_Type;
+
       /* Bitvector ====================================================== */
 
       //! pyBitvector object.
@@ -424,6 +439,9 @@ namespace triton {
 /*! Returns the triton::ast::AbstractNode. */
 #define PyAstNode_AsAstNode(v) (((triton::bindings::python::AstNode_Object*)(v))->node)
 
+/*! Returns the triton::ast::AstTape. */
+#define PyAstTape_AsAstTape(v) (((triton::bindings::python::AstTape_Object*)(v))->tape)
+
 /*! Checks if the pyObject is a triton::arch::BitsVector. */
 #define PyBitvector_Check(v)  ((v)->ob_type == &triton::bindings::python::Bitvector_Type)
 
@@ -556,6 +574,9 @@ namespace triton {
 /*! Checks if the pyObject is a triton::ast::AbstractNode. */
 #define PyAstNode_Check(v) ((v)->ob_type == &triton::bindings::python::AstNode_Type)
 
+/*! Checks if the pyObject is a triton::ast::AstTape. */
+#define PyAstTape_Check(v) ((v)->ob_type == &triton::bindings::python::AstTape_Type)
+
 /*! Checks if the pyObject is a triton::engines::symbolic::SymbolicExpression. */
 #define PySymbolicExpression_Check(v) ((v)->ob_type == &triton::bindings::python::SymbolicExpression_Type)
 
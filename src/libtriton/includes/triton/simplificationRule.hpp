@@ -0,0 +1,112 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SIMPLIFICATIONRULE_H
+#define TRITON_SIMPLIFICATIONRULE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! \class SimplificationRule
+      /*! \brief A rewriting rule written as `pattern -> replacement`.
+       *
+       * \description
+       * Both sides are SMT terms like `(bvxor x x) -> 0`. An operator is one of the `bv*` operators,
+       * `distinct`, `equal`, `ite`, `land`, `lnot` or `lor`. A name like `x` matches any node, and all
+       * the occurrences of a name must match equal nodes. A number like `0`, `0xff` or `-1` matches a
+       * bitvector constant of this value, truncated to its size. In the replacement, a number is a
+       * constant of the size of its siblings, or of the rewritten node. The childs of commutative
+       * operators are matched in both orders.
+       */
+      class SimplificationRule {
+        private:
+          //! A term of a pattern or of a replacement.
+          struct Term {
+            enum {OPERATION, NAME, NUMBER} type;
+            triton::ast::kind_e kind;
+            std::string name;
+            triton::uint512 value;
+            bool negative;
+            std::vector<Term> childs;
+          };
+
+          //! The nodes matched by the names of the pattern.
+          typedef std::map<std::string, triton::ast::AbstractNode*> Bindings;
+
+          //! The rule as written.
+          std::string rule;
+
+          //! The left side.
+          Term pattern;
+
+          //! The right side.
+          Term replacement;
+
+          //! Parses a term from `tokens`, starting at `index`.
+          Term parse(const std::vector<std::string>& tokens, triton::usize& index) const;
+
+          //! Returns the value of a number for a given size.
+          triton::uint512 getNumber(const Term& term, triton::uint32 size) const;
+
+          //! Returns all the ways `term` matches `node`, each one extending `bindings`.
+          std::vector<Bindings> match(const Term& term, triton::ast::AbstractNode* node, const Bindings& bindings) const;
+
+          //! Builds the node of `term`. Numbers without sibling have `size` bits.
+          triton::ast::AbstractNode* build(const Term& term, const Bindings& bindings, triton::uint32 size) const;
+
+        public:
+          //! Constructor. Parses `rule`.
+          SimplificationRule(const std::string& rule);
+
+          //! Returns the rule as written.
+          const std::string& getRule(void) const;
+
+          //! Returns the kind of the root of the pattern.
+          triton::ast::kind_e getKind(void) const;
+
+          //! Returns the rewritten node if the pattern matches `node`, nullptr otherwise.
+          triton::ast::AbstractNode* apply(triton::ast::AbstractNode* node) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SIMPLIFICATIONRULE_H */
@@ -0,0 +1,125 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERBRANCHES_H
+#define TRITON_SOLVERBRANCHES_H
+
+#include <list>
+#include <map>
+#include <vector>
+
+#include <z3++.h>
+
+#include <triton/pathConstraint.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class SolverBranches
+      /*! \brief The untaken branches of a list of path constraints, solved in parallel.
+       *
+       * \description
+       * translate() is the only step which reads the symbolic engine. It translates the branches
+       * on the calling thread and gives each worker its own copy of the constraints it needs, in its
+       * own Z3 context (See: `Z3_ast_vector_translate`). solve() then runs the workers on their own
+       * threads, and they only touch their own context. The caller may thus release its locks (e.g.
+       * the Python GIL) during solve(), but not during translate().
+       */
+      class SolverBranches {
+        private:
+          //! A thread and the constraints it solves.
+          struct Worker {
+            //! The context of the worker. Declared first so that it is released last.
+            z3::context context;
+
+            //! The translated taken branches asserted by the worker, followed by its untaken branches.
+            z3::expr_vector exprs;
+
+            //! The number of taken branches in `exprs`.
+            triton::usize taken;
+
+            //! The untaken branches solved by the worker, as indexes in `prefixes`.
+            std::vector<triton::usize> branches;
+
+            //! Constructor.
+            Worker() : exprs(context), taken(0) {
+            }
+          };
+
+          //! The workers.
+          std::list<Worker> workers;
+
+          //! The number of taken branches which precede each untaken branch.
+          std::vector<triton::usize> prefixes;
+
+          //! The time limit of a branch in milliseconds (0 means no limit).
+          triton::uint32 timeout;
+
+          //! The memory limit of a branch in megabytes (0 means no limit).
+          triton::uint32 memoryLimit;
+
+          //! The conflict limit of a branch (0 means no limit).
+          triton::uint32 conflictLimit;
+
+          //! Solves the branches of a worker in its context.
+          void solveWorker(Worker& worker, std::vector<std::map<triton::uint32, SolverModel>>& models) const;
+
+        public:
+          //! Constructor.
+          SolverBranches();
+
+          //! Translates the untaken branches of `pathConstraints` for at most `maxThreads` workers (0 means the number of hardware threads).
+          void translate(triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                         const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints,
+                         triton::uint32 maxThreads,
+                         triton::uint32 timeout,
+                         triton::uint32 memoryLimit,
+                         triton::uint32 conflictLimit);
+
+          //! Solves the translated branches and returns a model for each one, in the order of the branches.
+          /*! \brief list of map of symbolic variable id -> model
+           *
+           * \description
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           *
+           * A map is empty if its branch cannot be taken or if a limit is reached.
+           */
+          std::list<std::map<triton::uint32, SolverModel>> solve(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERBRANCHES_H */
@@ -0,0 +1,174 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERCACHE_H
+#define TRITON_SOLVERCACHE_H
+
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include <z3++.h>
+
+#include <triton/ast.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The maximum number of previous models tried against a new query.
+      const triton::uint32 SOLVER_CACHE_REUSED_MODELS = 16;
+
+      //! The default size limit (in bytes) of the cached queries.
+      const triton::usize SOLVER_CACHE_MAX_BYTES = 64 * 1024 * 1024;
+
+      //! \class SolverCache
+      /*! \brief The query result cache of the solver engine.
+       *
+       * \description
+       * Queries are keyed by a canonical serialization of their AST where references are resolved,
+       * so two constraints built separately but with the same semantics share the same entry, and
+       * two different constraints never do. An entry holds the status of the query (sat, unsat or
+       * timeout) and its model if it is sat. A timeout only answers the queries which allow as much
+       * time or less. On a miss, the last models found are tried against the new query before
+       * calling the solver (counterexample reuse).
+       *
+       * The keys grow with the queries, so the entries are bounded by their size in bytes (keys and
+       * models). Once over the limit, the least recently used entries are evicted. Entries are
+       * indexed by the hash of their key, and the key itself only confirms a match.
+       */
+      class SolverCache {
+        public:
+          //! A query already solved.
+          struct Entry {
+            //! The status of the query (SAT, UNSAT or TIMEOUT).
+            triton::engines::solver::status_e status;
+
+            //! The model of the query, empty unless it is sat.
+            std::map<triton::uint32, SolverModel> model;
+
+            //! The time limit reached (in milliseconds) if the status is TIMEOUT.
+            triton::uint32 timeout;
+          };
+
+        private:
+          //! A query already solved and its key.
+          struct Item {
+            //! The canonical key of the query.
+            std::string key;
+
+            //! The result of the query.
+            Entry entry;
+
+            //! The size of the item in bytes (approximate).
+            triton::usize bytes;
+          };
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! The results of queries already solved, the most recently used first.
+          std::list<Item> items;
+
+          //! The items by hash of their key.
+          std::unordered_multimap<triton::usize, std::list<Item>::iterator> index;
+
+          //! The size of all items in bytes.
+          triton::usize bytes;
+
+          //! The size limit of all items in bytes (0 means no limit).
+          triton::usize maxBytes;
+
+          //! The number of items evicted to stay under the size limit.
+          triton::usize evicted;
+
+          //! The last sat models, tried against new queries.
+          std::list<std::map<triton::uint32, SolverModel>> lastModels;
+
+          //! The number of queries found in the cache.
+          triton::usize hits;
+
+          //! The number of queries not found in the cache.
+          triton::usize misses;
+
+          //! The number of misses solved by a previous model.
+          triton::usize reused;
+
+          //! Returns the item of a key, `items.end()` if there is none.
+          std::list<Item>::iterator lookup(const std::string& key);
+
+          //! Evicts the least recently used items until the size limit is met.
+          void evict(void);
+
+        public:
+          //! Constructor.
+          SolverCache(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+
+          //! Destructor.
+          virtual ~SolverCache();
+
+          /*!
+           * \brief Returns the canonical key of a query.
+           *
+           * \description
+           * Each distinct sub-tree is serialized once, after its children, as its kind, its size, its value and the
+           * indexes of its children. Equal sub-trees get the same index whether they are shared or not, so the key
+           * only depends on the structure of the query and grows with its number of distinct sub-trees.
+           */
+          std::string getKey(triton::ast::AbstractNode* node) const;
+
+          //! Looks for a query already solved with a time limit of `timeout` (0 if none). Returns true and fills `entry` if found.
+          bool find(const std::string& key, triton::uint32 timeout, Entry& entry);
+
+          //! Tries the last models found against a translated query. Returns true and fills `model` if one satisfies it.
+          bool reuse(const z3::expr& expr, std::map<triton::uint32, SolverModel>& model);
+
+          //! Records the status of a query, its model if it is sat and the time limit reached if it is a timeout.
+          void record(const std::string& key, triton::engines::solver::status_e status, const std::map<triton::uint32, SolverModel>& model, triton::uint32 timeout);
+
+          //! Clears all entries and statistics. The size limit is kept.
+          void clear(void);
+
+          //! Sets the size limit of the entries in bytes (0 means no limit).
+          void setMaxBytes(triton::usize maxBytes);
+
+          //! Returns the statistics of the cache (entries, bytes, max_bytes, evicted, hits, misses and reused).
+          std::map<std::string, triton::usize> getStats(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCACHE_H */
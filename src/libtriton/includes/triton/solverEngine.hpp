@@ -12,12 +12,19 @@
 #include <list>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <z3++.h>
 
 #include <triton/ast.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/solverBranches.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/solverEnums.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/tritonToZ3Ast.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -50,6 +57,36 @@ namespace triton {
           //! Symbolic Engine API
           triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
+          //! The cache of the queries already solved.
+          SolverCache* cache;
+
+          //! The translator of getModel() and getModels(). Kept between queries so that its Z3 context is not built and destroyed for each query.
+          triton::ast::TritonToZ3Ast* translator;
+
+          //! The global time limit of a query in milliseconds (0 means no limit).
+          triton::uint32 timeout;
+
+          //! The global memory limit of a query in megabytes (0 means no limit).
+          triton::uint32 memoryLimit;
+
+          //! The global conflict limit of a query (0 means no limit).
+          triton::uint32 conflictLimit;
+
+          //! The statistics of the last query (status, nodes, variables, translation_time and solving_time).
+          std::map<std::string, triton::usize> queryStats;
+
+          //! Resets the statistics of the query about to be solved.
+          void resetQueryStats(void);
+
+          //! Returns the solver parameters for the given limits. A zero limit falls back on the global one.
+          z3::params getParams(z3::context& ctx, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit) const;
+
+          //! Translates a constraint and records its size and translation time in the query statistics.
+          z3::expr translate(triton::ast::TritonToZ3Ast& z3Ast, triton::ast::AbstractNode* node);
+
+          //! Solves a translated constraint and returns at most `limit` models. The status and the solving time are recorded in the query statistics.
+          std::list<std::map<triton::uint32, SolverModel>> solve(const z3::expr& expr, triton::uint32 limit, const z3::params& params);
+
         public:
           //! Constructor.
           SolverEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
@@ -57,14 +94,25 @@ namespace triton {
           //! Destructor.
           virtual ~SolverEngine();
 
-          //! Computes and returns a model from a symbolic constraint.
+          //! Computes and returns a model from a symbolic constraint. Results are cached, see triton::engines::solver::SolverCache.
           /*! \brief map of symbolic variable id -> model
            *
            * \description
            * **item1**: symbolic variable id<br>
            * **item2**: model
            */
-          std::map<triton::uint32, SolverModel> getModel(triton::ast::AbstractNode* node) const;
+          std::map<triton::uint32, SolverModel> getModel(triton::ast::AbstractNode* node);
+
+          //! Computes and returns a model from a symbolic constraint with per-call limits. A zero limit falls back on the global one.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \description
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           *
+           * The map is empty if the constraint is unsat or if a limit is reached. See getQueryStats() to know which one.
+           */
+          std::map<triton::uint32, SolverModel> getModel(triton::ast::AbstractNode* node, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit);
 
           //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
           /*! \brief list of map of symbolic variable id -> model
@@ -73,7 +121,60 @@ namespace triton {
            * **item1**: symbolic variable id<br>
            * **item2**: model
            */
-          std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const;
+          std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit);
+
+          //! Computes and returns several models from a symbolic constraint with per-call limits. A zero limit falls back on the global one.
+          std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 timeout, triton::uint32 memoryLimit, triton::uint32 conflictLimit);
+
+          //! Computes and returns a model for every untaken branch of the path constraints, using at most `maxThreads` threads.
+          /*! \brief list of map of symbolic variable id -> model
+           *
+           * \description
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           *
+           * Each untaken branch is solved with the taken branches which precede it. Models are returned
+           * in the order of the branches and a map is empty if its branch cannot be taken. Branches are
+           * translated on the calling thread, then each thread solves its copy in its own Z3 context (See:
+           * SolverBranches). If `maxThreads` is 0, the number of hardware threads is used. The global limits
+           * apply to each branch, and a branch which reaches a limit has an empty map.
+           */
+          std::list<std::map<triton::uint32, SolverModel>> getModelsForAllBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 maxThreads) const;
+
+          //! Translates the untaken branches of the path constraints for getModelsForAllBranches(). `branches` is then solved by SolverBranches::solve(), which does not read this engine.
+          void translateBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 maxThreads, SolverBranches& branches) const;
+
+          //! Sets the global time limit of a query in milliseconds (0 means no limit).
+          void setTimeout(triton::uint32 timeout);
+
+          //! Sets the global memory limit of a query in megabytes (0 means no limit).
+          void setMemoryLimit(triton::uint32 memoryLimit);
+
+          //! Sets the global conflict limit of a query (0 means no limit).
+          void setConflictLimit(triton::uint32 conflictLimit);
+
+          //! Returns the statistics of the last query solved by getModel() or getModels().
+          /*! \brief map of statistic name -> value
+           *
+           * \description
+           * **status**: the triton::engines::solver::status_e of the query<br>
+           * **nodes**: the number of unique nodes of the translated formula<br>
+           * **variables**: the number of symbolic variables of the formula<br>
+           * **translation_time**: the translation time in microseconds<br>
+           * **solving_time**: the solving time in microseconds
+           *
+           * A query answered by the cache is neither translated nor solved.
+           */
+          const std::map<std::string, triton::usize>& getQueryStats(void) const;
+
+          //! Returns the statistics of the query cache (entries, bytes, max_bytes, evicted, hits, misses and reused).
+          std::map<std::string, triton::usize> getCacheStats(void) const;
+
+          //! Clears the query cache.
+          void clearCache(void);
+
+          //! Sets the size limit of the query cache in bytes (0 means no limit).
+          void setCacheLimit(triton::usize maxBytes);
       };
 
     /*! @} End of solver namespace */
@@ -0,0 +1,53 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERENUMS_H
+#define TRITON_SOLVERENUMS_H
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! Enumerates all kinds of solver status.
+      enum status_e {
+        UNSAT = 0, //!< The constraint cannot be satisfied.
+        SAT,       //!< A model has been found.
+        TIMEOUT,   //!< The time limit has been reached.
+        UNKNOWN    //!< The solver gave up (memory or conflict limit, incomplete theory).
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERENUMS_H */
@@ -0,0 +1,168 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERSESSION_H
+#define TRITON_SOLVERSESSION_H
+
+#include <list>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <z3++.h>
+
+#include <triton/ast.hpp>
+#include <triton/modes.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/tritonToZ3Ast.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class SolverSession
+      /*! \brief The incremental solver session over the path constraints.
+       *
+       * \description
+       * The session keeps one Z3 solver alive for the whole trace. Each taken path constraint
+       * recorded by the path manager is translated and asserted only once. Untaken branches
+       * are solved in a push/pop scope on top of the constraints which precede them, so flipping
+       * every branch of a trace costs a single pass over it.
+       *
+       * If the triton::modes::PC_SLICING mode is enabled, path constraints are partitioned by the
+       * symbolic variables they use. A query is then solved only with the partitions which share
+       * variables with it, and the other partitions keep the model already found for them.
+       */
+      class SolverSession {
+        private:
+          //! Modes API
+          triton::modes::Modes* modes;
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! The translator used for the whole session. Its context is also the solver's context.
+          triton::ast::TritonToZ3Ast* translator;
+
+          //! The solver which holds all taken path constraints already asserted.
+          z3::solver* solver;
+
+          //! The number of path constraints already asserted.
+          triton::usize numberOfConstraints;
+
+          //! The generation of the last path constraint asserted, to detect path constraints which have been rewound.
+          triton::usize lastGeneration;
+
+          //! The number of AST nodes freed when the translator cache was last known valid (See: triton::ast::AbstractNode::getFreedNodes()).
+          triton::usize freedNodes;
+
+          //! The generation of the trees in use when the translator cache was last known valid (See: triton::ast::AbstractNode::getGeneration()).
+          triton::usize astGeneration;
+
+          //! The models of untaken branches already solved (one per untaken branch, empty if unsat).
+          std::list<std::map<triton::uint32, SolverModel>> branchModels;
+
+          //! The number of path constraints already partitioned.
+          triton::usize numberOfSlicedConstraints;
+
+          //! The partitions of symbolic variables as a union-find (variable id -> parent variable id).
+          std::map<triton::usize, triton::usize> partitions;
+
+          //! The symbolized taken path constraints already partitioned (a variable of the constraint, constraint).
+          std::vector<std::pair<triton::usize, triton::ast::AbstractNode*>> slicedConstraints;
+
+          //! The model of each partition (partition -> model, empty if unsat), reused by queries which do not use it.
+          std::map<triton::usize, std::map<triton::uint32, SolverModel>> partitionModels;
+
+          //! Initializes the translator and the solver.
+          void init(void);
+
+          //! Releases the translator and the solver.
+          void release(void);
+
+          //! Checks the assertions of a solver. Returns true and fills `model` if it is sat.
+          bool check(z3::solver& solver, std::map<triton::uint32, SolverModel>& model) const;
+
+          //! Collects the ids of the symbolic variables used by a node. References are resolved.
+          void collectVariables(triton::ast::AbstractNode* node, std::set<triton::usize>& variables, std::set<triton::ast::AbstractNode*>& visited) const;
+
+          //! Returns the partition of a symbolic variable.
+          triton::usize findPartition(triton::usize variable);
+
+          //! Partitions the taken path constraints up to `index` (excluded).
+          void slice(triton::usize index);
+
+          //! Solves a constraint with only the partitions it depends on, and completes the model with the other partitions.
+          std::map<triton::uint32, SolverModel> checkSliced(triton::ast::AbstractNode* node);
+
+        public:
+          //! Constructor.
+          SolverSession(triton::modes::Modes* modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+
+          //! Destructor.
+          virtual ~SolverSession();
+
+          //! Drops all assertions. The next query starts again from the first path constraint.
+          void reset(void);
+
+          //! Asserts the path constraints recorded since the last update and solves their untaken branches.
+          void update(void);
+
+          //! Returns the number of path constraints already asserted.
+          triton::usize getNumberOfConstraints(void) const;
+
+          //! Returns a model for every untaken branch of the path constraints, in the order of the trace.
+          /*! \brief list of map of symbolic variable id -> model
+           *
+           * \description
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           *
+           * A map is empty if its branch cannot be taken.
+           */
+          const std::list<std::map<triton::uint32, SolverModel>>& getModelsForUntakenBranches(void);
+
+          //! Computes and returns a model from a symbolic constraint conjoined with all path constraints.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \description
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          std::map<triton::uint32, SolverModel> getModel(triton::ast::AbstractNode* node);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERSESSION_H */
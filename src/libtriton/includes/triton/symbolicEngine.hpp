@@ -11,6 +11,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
@@ -21,7 +22,9 @@
 #include <triton/register.hpp>
 #include <triton/symbolicEnums.hpp>
 #include <triton/symbolicExpression.hpp>
+#include <triton/symbolicMemoryTable.hpp>
 #include <triton/symbolicSimplification.hpp>
+#include <triton/symbolicStorage.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -69,29 +72,14 @@ namespace triton {
           //! Symbolic variables id.
           triton::usize uniqueSymVarId;
 
-          /*! \brief The map of symbolic variables
-           *
-           * \description
-           * **item1**: variable id<br>
-           * **item2**: symbolic variable
-           */
-          std::map<triton::usize, SymbolicVariable*> symbolicVariables;
+          //! The symbolic variables indexed by their id.
+          SymbolicStorage<SymbolicVariable> symbolicVariables;
 
-          /*! \brief The map of symbolic expressions
-           *
-           * \description
-           * **item1**: symbolic reference id<br>
-           * **item2**: symbolic expression
-           */
-          std::map<triton::usize, SymbolicExpression*> symbolicExpressions;
+          //! The symbolic expressions indexed by their id.
+          SymbolicStorage<SymbolicExpression> symbolicExpressions;
 
-          /*! \brief map of address -> symbolic expression
-           *
-           * \description
-           * **item1**: memory address<br>
-           * **item2**: symbolic reference id
-           */
-          std::map<triton::uint64, triton::usize> memoryReference;
+          //! The symbolic expression id of each memory byte, by pages.
+          SymbolicMemoryTable memoryReference;
 
           /*! \brief map of <address:size> -> symbolic expression.
            *
@@ -101,6 +89,14 @@ namespace triton {
            */
           std::map<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*> alignedMemoryReference;
 
+          /*! \brief map of symbolic expression -> full AST (See: getFullAst()).
+           *
+           * \description
+           * **item1**: symbolic reference id<br>
+           * **item2**: <generation of the ASTs when unrolled (See: triton::ast::AbstractNode::getGeneration()), full AST>
+           */
+          std::unordered_map<triton::usize, std::pair<triton::usize, triton::ast::AbstractNode*>> fullAsts;
+
         private:
           //! Architecture API
           triton::arch::Architecture* architecture;
@@ -114,8 +110,11 @@ namespace triton {
           //! Defines if this instance is used as a backup.
           bool backupFlag;
 
+          //! Returns a node whose references are replaced by the full ASTs of their expressions. `visited` maps the nodes already unrolled by this call.
+          triton::ast::AbstractNode* unrollAst(triton::ast::AbstractNode* root, std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& visited);
+
           //! Slices all expressions from a given node.
-          void sliceExpressions(triton::ast::AbstractNode* node, std::map<triton::usize, SymbolicExpression*>& exprs);
+          void sliceExpressions(triton::ast::AbstractNode* root, std::map<triton::usize, SymbolicExpression*>& exprs);
 
         public:
           //! Constructor. If you use this class as backup or copy you should define the `isBackup` flag as true.
@@ -253,12 +252,19 @@ namespace triton {
           //! Assigns a symbolic expression to a memory.
           void assignSymbolicExpressionToMemory(SymbolicExpression *se, const triton::arch::MemoryAccess& mem);
 
-          //! Returns the full AST of a root node.
-          triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed);
-
-          //! Returns the full AST of a root node.
+          /*!
+           * \brief Returns the full AST of a root node.
+           *
+           * \details
+           * The partial AST is left untouched: the nodes which lead to a reference are copied and the
+           * other ones are shared. The full AST of each expression is built once and kept until the
+           * expression is removed or its AST is replaced, so unrolling the same expressions again is cheap.
+           */
           triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node);
 
+          //! Forgets the full ASTs already built. Must be called when the AST of a symbolic expression is replaced.
+          void invalidateFullAsts(void);
+
           //! Slices all expressions from a given one.
           std::map<triton::usize, SymbolicExpression*> sliceExpressions(SymbolicExpression* expr);
 
@@ -266,10 +272,10 @@ namespace triton {
           std::list<SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
           //! Returns all symbolic expressions.
-          const std::map<triton::usize, SymbolicExpression*>& getSymbolicExpressions(void) const;
+          const SymbolicStorage<SymbolicExpression>& getSymbolicExpressions(void) const;
 
           //! Returns all symbolic variables.
-          const std::map<triton::usize, SymbolicVariable*>& getSymbolicVariables(void) const;
+          const SymbolicStorage<SymbolicVariable>& getSymbolicVariables(void) const;
 
           //! Returns all variable declarations representation.
           std::string getVariablesDeclaration(void) const;
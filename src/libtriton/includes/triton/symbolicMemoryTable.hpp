@@ -0,0 +1,106 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLICMEMORYTABLE_H
+#define TRITON_SYMBOLICMEMORYTABLE_H
+
+#include <unordered_map>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! log2 of the number of bytes per page of triton::engines::symbolic::SymbolicMemoryTable.
+      const triton::uint32 MEMORY_PAGE_BITS = 12;
+
+      //! The number of bytes per page of triton::engines::symbolic::SymbolicMemoryTable.
+      const triton::uint64 MEMORY_PAGE_SIZE = static_cast<triton::uint64>(1) << MEMORY_PAGE_BITS;
+
+      /*! \class SymbolicMemoryTable
+       *  \brief The symbolic expression ids of the memory bytes, by pages.
+       *
+       * \description
+       * Each 4 KiB page holds the expression ids of its bytes and the number of bytes which have one.
+       * A page is allocated on the first byte written and freed with its last byte, so a missing page
+       * means all its bytes are concrete and a load over concrete memory costs one probe per page.
+       */
+      class SymbolicMemoryTable {
+        public:
+          //! The ids of the bytes of a page.
+          struct Page {
+            //! The expression id of each byte, triton::engines::symbolic::UNSET if concrete.
+            std::vector<triton::usize> ids;
+
+            //! The number of bytes which have an id.
+            triton::usize count;
+          };
+
+        private:
+          //! The pages which have at least one id, by page number.
+          std::unordered_map<triton::uint64, Page> pages;
+
+          //! The number of bytes which have an id.
+          triton::usize count;
+
+        public:
+          //! Constructor.
+          SymbolicMemoryTable();
+
+          //! Returns the expression id of a byte, triton::engines::symbolic::UNSET if it is concrete.
+          triton::usize get(triton::uint64 addr) const;
+
+          //! Sets the expression id of a byte.
+          void set(triton::uint64 addr, triton::usize id);
+
+          //! Concretizes a byte.
+          void erase(triton::uint64 addr);
+
+          //! Concretizes all the bytes.
+          void clear(void);
+
+          //! Returns true if the `size` bytes from `addr` are all concrete.
+          bool isConcrete(triton::uint64 addr, triton::uint64 size) const;
+
+          //! Returns the number of bytes which have an id.
+          triton::usize size(void) const;
+
+          //! Returns the pages by page number. The address of a byte is `(number << MEMORY_PAGE_BITS) + index`.
+          const std::unordered_map<triton::uint64, Page>& getPages(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICMEMORYTABLE_H */
@@ -8,8 +8,15 @@
 #ifndef TRITON_SYMBOLICSIMPLIFICATION_H
 #define TRITON_SYMBOLICSIMPLIFICATION_H
 
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <triton/ast.hpp>
+#include <triton/astEnums.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/simplificationRule.hpp>
 
 
 
@@ -43,6 +50,18 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! The rewriting rules, indexed by the kind of the root of their pattern.
+          std::map<triton::ast::kind_e, std::vector<SimplificationRule>> rules;
+
+          //! True if the operations on constants are replaced by their value.
+          bool constantFolding;
+
+          //! Rewrites the tree of `root` bottom-up. `rewritten` maps each node already visited to its rewritten node.
+          triton::ast::AbstractNode* rewrite(triton::ast::AbstractNode* root, std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& rewritten, triton::uint32 depth) const;
+
+          //! Applies the first rule which matches the root of `node`. Returns nullptr if none matches.
+          triton::ast::AbstractNode* rewriteNode(triton::ast::AbstractNode* node) const;
+
         public:
           //! Constructor.
           SymbolicSimplification(triton::callbacks::Callbacks* callbacks=nullptr);
@@ -59,6 +78,18 @@ namespace triton {
           //! Processes all recorded simplifications. Returns the simplified node.
           triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node) const;
 
+          //! Adds a rewriting rule. See SimplificationRule for the syntax.
+          void addSimplificationRule(const std::string& rule);
+
+          //! Adds the built-in rewriting rules and enables the constant folding.
+          void addDefaultSimplificationRules(void);
+
+          //! Removes all rewriting rules and disables the constant folding.
+          void clearSimplificationRules(void);
+
+          //! Returns the rewriting rules.
+          std::vector<std::string> getSimplificationRules(void) const;
+
           //! Copies a SymbolicSimplification.
           void operator=(const SymbolicSimplification& other);
       };
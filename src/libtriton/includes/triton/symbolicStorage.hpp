@@ -0,0 +1,234 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLICSTORAGE_H
+#define TRITON_SYMBOLICSTORAGE_H
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class SymbolicStorage
+       *  \brief Pointers indexed by the ids of the symbolic engine.
+       *
+       * \description
+       * Ids are given by increasing counters, so the pointers are stored in chunks indexed by the id
+       * instead of a tree. A lookup is two loads and the chunks never move once allocated. A removed
+       * id leaves a nullptr, and a chunk left without any pointer is released (its entry in the
+       * directory becomes empty until an id of the chunk is set again). The storage is iterated in
+       * the order of the ids and its iterators give `(id, pointer)` pairs, as a
+       * `std::map<triton::usize, T*>` would.
+       */
+      template <typename T>
+      class SymbolicStorage {
+        private:
+          //! log2 of the number of ids per chunk.
+          static const triton::usize CHUNK_BITS = 10;
+
+          //! The number of ids per chunk.
+          static const triton::usize CHUNK_SIZE = static_cast<triton::usize>(1) << CHUNK_BITS;
+
+          //! The chunks of pointers. A released chunk is empty.
+          std::vector<std::vector<T*>> chunks;
+
+          //! The number of pointers per chunk, to skip the empty ones.
+          std::vector<triton::usize> counts;
+
+          //! The number of pointers.
+          triton::usize count;
+
+        public:
+          //! An iterator over the `(id, pointer)` pairs, in the order of the ids.
+          class const_iterator : public std::iterator<std::forward_iterator_tag, const std::pair<triton::usize, T*>> {
+            private:
+              //! The storage iterated.
+              const SymbolicStorage* storage;
+
+              //! The current pair.
+              std::pair<triton::usize, T*> item;
+
+              //! Moves to the first pointer from the current id.
+              void seek(void) {
+                triton::usize end = this->storage->chunks.size() << CHUNK_BITS;
+
+                while (this->item.first < end) {
+                  triton::usize chunk = this->item.first >> CHUNK_BITS;
+                  if (this->storage->counts[chunk] == 0) {
+                    this->item.first = (chunk + 1) << CHUNK_BITS;
+                    continue;
+                  }
+                  this->item.second = this->storage->chunks[chunk][this->item.first & (CHUNK_SIZE - 1)];
+                  if (this->item.second != nullptr)
+                    return;
+                  this->item.first++;
+                }
+
+                this->item.first  = end;
+                this->item.second = nullptr;
+              }
+
+            public:
+              //! Constructor. Points nowhere.
+              const_iterator() : storage(nullptr), item(0, nullptr) {
+              }
+
+              //! Constructor. Points to the first pointer from `id`.
+              const_iterator(const SymbolicStorage* storage, triton::usize id) : storage(storage), item(id, nullptr) {
+                this->seek();
+              }
+
+              const std::pair<triton::usize, T*>& operator*(void) const {
+                return this->item;
+              }
+
+              const std::pair<triton::usize, T*>* operator->(void) const {
+                return &this->item;
+              }
+
+              const_iterator& operator++(void) {
+                this->item.first++;
+                this->seek();
+                return *this;
+              }
+
+              const_iterator operator++(int) {
+                const_iterator old = *this;
+                ++(*this);
+                return old;
+              }
+
+              bool operator==(const const_iterator& other) const {
+                return this->item.first == other.item.first;
+              }
+
+              bool operator!=(const const_iterator& other) const {
+                return this->item.first != other.item.first;
+              }
+          };
+
+          //! The iterators never modify the storage.
+          typedef const_iterator iterator;
+
+          //! Constructor.
+          SymbolicStorage() : count(0) {
+          }
+
+          //! Returns the pointer of `id`, nullptr if there is none.
+          T* get(triton::usize id) const {
+            triton::usize chunk = id >> CHUNK_BITS;
+            if (chunk >= this->chunks.size() || this->counts[chunk] == 0)
+              return nullptr;
+            return this->chunks[chunk][id & (CHUNK_SIZE - 1)];
+          }
+
+          //! Sets the pointer of `id`. A nullptr removes it.
+          void set(triton::usize id, T* value) {
+            triton::usize chunk = id >> CHUNK_BITS;
+
+            if (value == nullptr) {
+              this->erase(id);
+              return;
+            }
+
+            while (chunk >= this->chunks.size()) {
+              this->chunks.push_back(std::vector<T*>());
+              this->counts.push_back(0);
+            }
+
+            /* A released chunk is allocated again */
+            if (this->chunks[chunk].empty())
+              this->chunks[chunk].assign(CHUNK_SIZE, nullptr);
+
+            T*& slot = this->chunks[chunk][id & (CHUNK_SIZE - 1)];
+            if (slot == nullptr) {
+              this->counts[chunk]++;
+              this->count++;
+            }
+            slot = value;
+          }
+
+          //! Removes the pointer of `id`. Its chunk is released once it has no pointer left.
+          void erase(triton::usize id) {
+            triton::usize chunk = id >> CHUNK_BITS;
+            if (chunk >= this->chunks.size() || this->counts[chunk] == 0)
+              return;
+
+            T*& slot = this->chunks[chunk][id & (CHUNK_SIZE - 1)];
+            if (slot != nullptr) {
+              slot = nullptr;
+              this->count--;
+              if (--this->counts[chunk] == 0)
+                std::vector<T*>().swap(this->chunks[chunk]);
+            }
+          }
+
+          //! Returns an iterator to the pointer of `id`, end() if there is none.
+          const_iterator find(triton::usize id) const {
+            if (this->get(id) == nullptr)
+              return this->end();
+            return const_iterator(this, id);
+          }
+
+          //! Returns the first pair.
+          const_iterator begin(void) const {
+            return const_iterator(this, 0);
+          }
+
+          //! Returns the end of the pairs.
+          const_iterator end(void) const {
+            return const_iterator(this, this->chunks.size() << CHUNK_BITS);
+          }
+
+          //! Returns the number of pointers.
+          triton::usize size(void) const {
+            return this->count;
+          }
+
+          //! Returns true if there is no pointer.
+          bool empty(void) const {
+            return this->count == 0;
+          }
+      };
+
+      template <typename T> const triton::usize SymbolicStorage<T>::CHUNK_BITS;
+      template <typename T> const triton::usize SymbolicStorage<T>::CHUNK_SIZE;
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICSTORAGE_H */
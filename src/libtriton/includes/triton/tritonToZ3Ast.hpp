@@ -8,6 +8,9 @@
 #ifndef TRITON_TRITONTOZ3AST_H
 #define TRITON_TRITONTOZ3AST_H
 
+#include <map>
+#include <string>
+
 #include <z3++.h>
 
 #include <triton/ast.hpp>
@@ -43,13 +46,38 @@ namespace triton {
         //! This flag define if the conversion is used to evaluated a node or not.
         bool isEval;
 
-        //! The map of symbols. E.g: (let (symbols expr1) expr2)
-        std::map<std::string, triton::ast::AbstractNode*> symbols;
+        //! Translates a node whose childs are already translated, or translates them recursively.
+        Z3Result& translate(triton::ast::AbstractNode& e);
 
       protected:
         //! The result.
         Z3Result result;
 
+        /*!
+         * \brief The per-translation cache of already translated nodes.
+         *
+         * \details Declared after the result so that cached expressions are
+         * released before the context which owns them.
+         */
+        std::map<triton::ast::AbstractNode*, z3::expr> exprs;
+
+        //! The per-translation cache of already translated references (symbolic expression id -> z3 expr).
+        std::map<triton::usize, z3::expr> references;
+
+        //! The translated values of the symbols in scope. E.g: (let (symbols expr1) expr2)
+        std::map<std::string, z3::expr> symbols;
+
+        /*!
+         * \brief The cache of the nodes translated in the body of the current let.
+         *
+         * \details A node under a let may depend on its symbol, so it is only cached for the scope
+         * of its let. Each let body is translated with an empty scope, as triton::ast::AstTape does.
+         */
+        std::map<triton::ast::AbstractNode*, z3::expr> scopeExprs;
+
+        //! The number of let bodies being translated.
+        triton::uint32 scopeDepth;
+
       public:
         //! Constructor.
         TritonToZ3Ast(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval=true);
@@ -60,6 +88,12 @@ namespace triton {
         //! Evaluates a Triton AST.
         virtual Z3Result& eval(triton::ast::AbstractNode& e);
 
+        //! Returns the context in which all expressions are built.
+        z3::context& getContext(void);
+
+        //! Forgets the translated nodes and references, e.g. once nodes have been freed and their addresses may be given again.
+        void clearCache(void);
+
         //! Evaluate operator.
         virtual void operator()(triton::ast::AbstractNode& e);
         //! Evaluate operator.
@@ -8,6 +8,8 @@
 #ifndef TRITON_Z3TOTRITONAST_H
 #define TRITON_Z3TOTRITONAST_H
 
+#include <map>
+
 #include <z3++.h>
 
 #include <triton/ast.hpp>
@@ -48,6 +50,9 @@ namespace triton {
         //! The Z3's expression which must be converted to a Triton's expression.
         z3::expr expr;
 
+        //! The per-conversion cache of already converted Z3's nodes (z3 ast id -> Triton node).
+        std::map<triton::uint32, triton::ast::AbstractNode*> nodes;
+
       public:
         //! Constructor.
         Z3ToTritonAst(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
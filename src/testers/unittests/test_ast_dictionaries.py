@@ -41,3 +41,29 @@ class TestAstDictionaries(unittest.TestCase):
         self.assertEqual(d['decimal'], 3)
         self.assertEqual(d['allocatedDictionaries'], 5)
         self.assertEqual(d['allocatedNodes'], 12)
+
+    def test_reclamation(self):
+        # The canonical nodes of the removed expressions are freed and leave the dictionaries
+        enableMode(MODE.ONLY_ON_SYMBOLIZED, True)
+
+        inst = Instruction()
+        inst.setOpcodes("\x48\xFF\xC0") # inc rax
+        processing(inst)
+        before = getAstMemoryStats()
+        dictionaries = getAstDictionariesStats()
+
+        for i in range(100):
+            inst = Instruction()
+            inst.setOpcodes("\x48\xFF\xC0")
+            processing(inst)
+
+        self.assertEqual(getAstMemoryStats()['nodes'], before['nodes'])
+        self.assertEqual(getAstDictionariesStats()['allocatedDictionaries'], dictionaries['allocatedDictionaries'])
+
+        # The slots of the freed nodes are reused: the bv and the decimals of its value and size
+        a = bv(0x1234, 64)
+        b = bv(0x1234, 64)
+        self.assertEqual(getAstDictionariesStats()['allocatedDictionaries'], dictionaries['allocatedDictionaries'] + 3)
+        self.assertEqual(b.evaluate(), 0x1234)
+
+        enableMode(MODE.ONLY_ON_SYMBOLIZED, False)
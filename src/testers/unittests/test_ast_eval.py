@@ -7,7 +7,9 @@ import unittest
 from triton import setArchitecture, ARCH, evaluateAstViaZ3
 from triton.ast import (bv, bvsub, bvadd, bvxor, bvor, bvand, bvnand, bvnor,
                         bvxnor, bvmul, bvneg, bvnot, bvsdiv, sx, zx, bvudiv,
-                        bvashr, bvlshr, bvshl, bvrol, bvror, bvsmod, bvsrem)
+                        bvashr, bvlshr, bvshl, bvrol, bvror, bvsmod, bvsrem,
+                        bvslt, bvult, concat, extract, ite, equal, let,
+                        string)
 
 
 class TestAstEval(unittest.TestCase):
@@ -802,3 +804,40 @@ class TestAstEval(unittest.TestCase):
             bvsrem(zx(64, bv(9223372036854775808, 64)), sx(64, bv(18446744073709551615, 64))),
         ]
         self.check_ast(tests)
+
+    def test_widths(self):
+        """Check operations on 64 bits or fewer and on wider nodes."""
+        tests = [
+            bvadd(bv(0xffffffffffffffff, 64), bv(1, 64)),
+            bvmul(bv(0xffffffffffffffff, 64), bv(0xffffffffffffffff, 64)),
+            bvneg(bv(0, 64)),
+            bvashr(bv(0x8000000000000000, 64), bv(0, 64)),
+            bvashr(bv(0x8000000000000000, 64), bv(63, 64)),
+            bvashr(bv(0x8000000000000000, 64), bv(64, 64)),
+            bvshl(bv(1, 64), bv(64, 64)),
+            bvlshr(bv(0x8000000000000000, 64), bv(64, 64)),
+            bvrol(0, bv(0x8000000000000001, 64)),
+            bvror(63, bv(0x8000000000000001, 64)),
+            ite(bvslt(bv(0x8000000000000000, 64), bv(1, 64)), bv(1, 8), bv(0, 8)),
+            concat([bv(0x12345678, 32), bv(0x9abcdef0, 32)]),
+            concat([bv(0x12345678, 32), bv(0x9abcdef0, 32), bv(0xff, 8)]),
+            extract(71, 8, bv(0x112233445566778899aabbccddeeff, 128)),
+            extract(7, 0, bv(0x112233445566778899aabbccddeeff, 128)),
+            sx(64, bv(0x8000000000000000, 64)),
+            zx(64, bv(0x8000000000000000, 64)),
+            ite(bvult(bv(0x10000000000000000, 128), bv(1, 128)), bv(1, 8), bv(0, 8)),
+            bvadd(bv(0xffffffffffffffffffffffffffffffff, 128), bv(1, 128)),
+            bvudiv(bv(0x10000000000000000, 128), bv(0, 128)),
+            ite(equal(bv(1, 64), bv(1, 64)), bv(0x10000000000000000, 128), bv(2, 128)),
+        ]
+        self.check_ast(tests)
+
+    def test_shared_let_body(self):
+        """Check two lets which share a body get their own bindings."""
+        body = bvadd(string("a"), string("a"))
+        node = concat([let("a", bv(1, 8), body), let("a", bv(2, 8), body)])
+        self.assertEqual(evaluateAstViaZ3(node), 0x0204)
+
+        # A let inside the body of another one
+        node = let("a", bv(1, 8), concat([body, let("a", bv(3, 8), body), body]))
+        self.assertEqual(evaluateAstViaZ3(node), 0x020602)
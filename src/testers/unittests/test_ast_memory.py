@@ -0,0 +1,75 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the memory used by AST nodes."""
+
+import unittest
+
+from triton     import *
+from triton.ast import *
+
+
+class TestAstMemory(unittest.TestCase):
+
+    """Testing the memory used by AST nodes."""
+
+    def setUp(self):
+        """Define the arch."""
+        setArchitecture(ARCH.X86_64)
+
+    def test_nodes(self):
+        before = getAstMemoryStats()
+
+        a = bv(1, 8)
+        b = bv(2, 8)
+        c = a + b
+
+        after = getAstMemoryStats()
+        # bv(1, 8), bv(2, 8), the decimals 1, 2 and 8 (shared by AST_DICTIONARIES) plus the bvadd
+        self.assertEqual(after['nodes'] - before['nodes'], 6)
+        self.assertGreater(after['nodes_memory'], before['nodes_memory'])
+        self.assertGreater(after['bytes_per_node'], 0)
+        self.assertGreaterEqual(after['reserved_memory'], after['nodes_memory'] + after['out_of_line_memory'])
+
+    def test_out_of_line(self):
+        # Up to three childs and a single parent fit in a node
+        before = getAstMemoryStats()
+        a = bv(1, 8)
+        b = bvadd(a, a)
+        after = getAstMemoryStats()
+        self.assertEqual(after['out_of_line_blocks'], before['out_of_line_blocks'])
+
+        # More childs go out of line
+        before = getAstMemoryStats()
+        c = concat([bv(i, 8) for i in range(8)])
+        after = getAstMemoryStats()
+        self.assertGreater(after['out_of_line_blocks'], before['out_of_line_blocks'])
+
+        # So do the values wider than 64 bits
+        before = getAstMemoryStats()
+        d = bv(0x112233445566778899, 128)
+        after = getAstMemoryStats()
+        self.assertGreater(after['out_of_line_memory'], before['out_of_line_memory'])
+
+        self.assertEqual(c.evaluate(), 0x0001020304050607)
+        self.assertEqual(d.evaluate(), 0x112233445566778899)
+
+    def test_reclamation(self):
+        # Expressions which are not symbolized are removed with their nodes
+        enableMode(MODE.ONLY_ON_SYMBOLIZED, True)
+
+        inst = Instruction()
+        inst.setOpcodes("\x48\xFF\xC0") # inc rax
+        processing(inst)
+        before = getAstMemoryStats()
+        rax = getConcreteRegisterValue(REG.RAX)
+
+        for i in range(100):
+            inst = Instruction()
+            inst.setOpcodes("\x48\xFF\xC0")
+            processing(inst)
+
+        after = getAstMemoryStats()
+        self.assertEqual(after['nodes'], before['nodes'])
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), rax + 100)
+
+        enableMode(MODE.ONLY_ON_SYMBOLIZED, False)
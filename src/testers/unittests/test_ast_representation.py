@@ -86,3 +86,35 @@ class TestAstRepresentation(unittest.TestCase):
         for n in self.node:
             self.assertEqual(str(n[0]), n[2])
 
+    def test_smt_dag_representation(self):
+        setAstRepresentationMode(AST_REPRESENTATION.SMT_DAG)
+        # Without shared nodes, it is the SMT representation
+        for n in self.node:
+            self.assertEqual(str(n[0]), n[1])
+
+        x = self.v1 + self.v2
+        y = x * x
+        self.assertEqual(str(y ^ y), "(let ((dag!0 (bvadd SymVar_0 SymVar_1))) (let ((dag!1 (bvmul dag!0 dag!0))) (bvxor dag!1 dag!1)))")
+        self.assertEqual(str(assert_(y == y)), "(assert (let ((dag!0 (bvadd SymVar_0 SymVar_1))) (let ((dag!1 (bvmul dag!0 dag!0))) (= dag!1 dag!1))))")
+
+        # The shared nodes of the body of a let stay in its scope
+        self.assertEqual(str(let("alias", self.v1, y)), "(let ((alias SymVar_0)) (let ((dag!0 (bvadd SymVar_0 SymVar_1))) (bvmul dag!0 dag!0)))")
+
+        # The text grows with the number of nodes
+        node = self.v1
+        for i in range(100):
+            node = node + node
+        self.assertEqual(str(node).count("bvadd"), 100)
+        setAstRepresentationMode(AST_REPRESENTATION.SMT)
+
+    def test_deep_representation(self):
+        """The representations and the deep copies do not recurse on deep trees."""
+        node = self.v1
+        for i in range(100000):
+            node = node + self.v2
+        self.assertTrue(duplicate(node).equalTo(node))
+
+        for mode, text in ((AST_REPRESENTATION.SMT, "bvadd"), (AST_REPRESENTATION.PYTHON, " + "), (AST_REPRESENTATION.SMT_DAG, "bvadd")):
+            setAstRepresentationMode(mode)
+            self.assertEqual(str(node).count(text), 100000)
+        setAstRepresentationMode(AST_REPRESENTATION.SMT)
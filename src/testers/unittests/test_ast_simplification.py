@@ -51,6 +51,23 @@ class TestAstSimplification(unittest.TestCase):
         self.assertEqual(str(c), "(bvxor (_ bv2 8) (_ bv1 8))")
         return
 
+    def test_equality(self):
+        a = variable(newSymbolicVariable(8))
+        b = variable(newSymbolicVariable(8))
+
+        # Trees built twice
+        self.assertTrue(((a + b) ^ ~a).equalTo((a + b) ^ ~a))
+        self.assertEqual(((a + b) ^ ~a).getHash(), ((a + b) ^ ~a).getHash())
+
+        # Commutative operators
+        self.assertTrue((a + b).equalTo(b + a))
+        self.assertFalse((a - b).equalTo(b - a))
+
+        # Different values or sizes
+        self.assertFalse((a + bv(1, 8)).equalTo(a + bv(2, 8)))
+        self.assertFalse(bv(1, 8).equalTo(bv(1, 16)))
+        self.assertFalse(a.equalTo(b))
+
     # a ^ a -> a = 0
     @staticmethod
     def xor_1(node):
@@ -94,3 +111,79 @@ class TestAstSimplification(unittest.TestCase):
                     return c1_nonNot ^ c2_nonNot
 
         return node
+
+
+class TestAstRewriting(unittest.TestCase):
+
+    """Testing the rewriting rules."""
+
+    def setUp(self):
+        setArchitecture(ARCH.X86_64)
+        self.a = variable(newSymbolicVariable(8))
+        self.b = variable(newSymbolicVariable(8))
+
+    def test_rule(self):
+        a = self.a
+        b = self.b
+
+        addSimplificationRule('(bvsub (bvor x y) (bvand x y)) -> (bvxor x y)')
+        self.assertEqual(getSimplificationRules(), ['(bvsub (bvor x y) (bvand x y)) -> (bvxor x y)'])
+
+        self.assertTrue(simplify((a | b) - (a & b)).equalTo(a ^ b))
+        # The childs of commutative operators are matched in both orders
+        self.assertTrue(simplify((b | a) - (a & b)).equalTo(a ^ b))
+        # A name matches equal nodes only
+        c = (a | b) - (a & (b + bv(1, 8)))
+        self.assertTrue(simplify(c).equalTo(c))
+        # The rules are applied bottom-up
+        self.assertTrue(simplify(((a | b) - (a & b)) + a).equalTo((a ^ b) + a))
+
+        clearSimplificationRules()
+        self.assertEqual(getSimplificationRules(), [])
+        self.assertTrue(simplify((a | b) - (a & b)).equalTo((a | b) - (a & b)))
+
+    def test_invalid_rules(self):
+        self.assertRaises(TypeError, addSimplificationRule, '(bvxor x x)')
+        self.assertRaises(TypeError, addSimplificationRule, '(bvfoo x x) -> 0')
+        self.assertRaises(TypeError, addSimplificationRule, '(bvxor x) -> 0')
+        self.assertRaises(TypeError, addSimplificationRule, '(bvxor x x -> 0')
+        self.assertRaises(TypeError, addSimplificationRule, '(bvxor x x) -> y')
+        self.assertRaises(TypeError, addSimplificationRule, 'x -> 0')
+        self.assertRaises(TypeError, addSimplificationRule, 1)
+
+    def test_default_rules(self):
+        a = self.a
+        b = self.b
+
+        addDefaultSimplificationRules()
+
+        # Constant folding
+        self.assertEqual(str(simplify(bv(3, 8) * bv(5, 8))), "(_ bv15 8)")
+        self.assertEqual(str(simplify(~(bv(1, 8) ^ bv(1, 8)))), "(_ bv255 8)")
+        self.assertTrue(simplify(a + (bv(3, 8) - bv(3, 8))).equalTo(a))
+
+        # Identities, with numbers truncated to the size of the node
+        self.assertEqual(str(simplify(a ^ a)), "(_ bv0 8)")
+        self.assertTrue(simplify(a & bv(0xff, 8)).equalTo(a))
+        self.assertTrue(simplify(a ^ bv(0xff, 8)).equalTo(~a))
+        self.assertTrue(simplify(~~a).equalTo(a))
+
+        # A replacement is rewritten again
+        self.assertTrue(simplify(-(~a + bv(1, 8))).equalTo(a))
+
+        # Mixed boolean-arithmetic
+        self.assertTrue(simplify((a ^ b) + (bv(2, 8) * (a & b))).equalTo(a + b))
+        self.assertTrue(simplify((a + b) - (a & b)).equalTo(a | b))
+        self.assertTrue(simplify((a & ~b) | (~a & b)).equalTo(a ^ b))
+
+    def test_symbolic_expressions(self):
+        addDefaultSimplificationRules()
+        convertRegisterToSymbolicVariable(REG.RAX)
+
+        inst = Instruction()
+        inst.setOpcodes("\x31\xc0") # xor eax, eax
+        processing(inst)
+
+        node = getSymbolicExpressionFromId(getSymbolicRegisterId(REG.RAX)).getAst()
+        self.assertEqual(node.getKind(), AST_NODE.BV)
+        self.assertEqual(node.evaluate(), 0)
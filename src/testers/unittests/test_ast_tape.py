@@ -0,0 +1,124 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Testing the compiled AST evaluator."""
+
+import random
+import unittest
+
+from triton     import *
+from triton.ast import *
+
+
+# Builds a node from two operands of the same size
+OPERATIONS = [
+    lambda a, b: bvadd(a, b),
+    lambda a, b: bvsub(a, b),
+    lambda a, b: bvmul(a, b),
+    lambda a, b: bvand(a, b),
+    lambda a, b: bvor(a, b),
+    lambda a, b: bvxor(a, b),
+    lambda a, b: bvnand(a, b),
+    lambda a, b: bvnor(a, b),
+    lambda a, b: bvxnor(a, b),
+    lambda a, b: bvnot(a),
+    lambda a, b: bvneg(a),
+    lambda a, b: bvshl(a, b),
+    lambda a, b: bvlshr(a, b),
+    lambda a, b: bvashr(a, b),
+    lambda a, b: bvrol(3, a),
+    lambda a, b: bvror(5, a),
+    lambda a, b: bvudiv(a, b),
+    lambda a, b: bvurem(a, b),
+    lambda a, b: bvsdiv(a, b),
+    lambda a, b: bvsrem(a, b),
+    lambda a, b: bvsmod(a, b),
+    lambda a, b: ite(bvslt(a, b), a, b),
+    lambda a, b: ite(bvsge(a, b), a, b),
+    lambda a, b: ite(bvult(a, b), a, b),
+    lambda a, b: ite(bvuge(a, b), a, b),
+    lambda a, b: ite(land(equal(a, b), lnot(distinct(a, b))), a, b),
+    lambda a, b: ite(lor(equal(a, bv(3, a.getBitvectorSize())), bvugt(a, b)), a, b),
+    lambda a, b: extract(a.getBitvectorSize() / 2, 1, concat([a, b])),
+    lambda a, b: extract(a.getBitvectorSize() - 1, 0, sx(8, a)),
+    lambda a, b: extract(a.getBitvectorSize() - 1, 0, zx(72, bvadd(a, b))),
+]
+
+
+class TestAstTape(unittest.TestCase):
+
+    """Testing the compiled AST evaluator."""
+
+    def setUp(self):
+        """Define the arch."""
+        setArchitecture(ARCH.X86_64)
+        random.seed(0)
+
+    def check_tape(self, size):
+        x = newSymbolicVariable(size)
+        y = newSymbolicVariable(size)
+        for operation in OPERATIONS:
+            node = operation(variable(x), variable(y))
+            tape = compileAst(node)
+            self.assertEqual(tape.getBitvectorSize(), node.getBitvectorSize())
+            inputs   = []
+            expected = []
+            for i in range(70):
+                a = random.getrandbits(size)
+                b = random.choice([0, 1, 3, random.getrandbits(size)])
+                inputs.append({x.getId(): a, y.getId(): b})
+                expected.append(operation(bv(a, size), bv(b, size)).evaluate())
+                self.assertEqual(tape.evaluate(inputs[-1]), expected[-1])
+            # More inputs than lanes, the last block is not full
+            self.assertEqual(tape.evaluateBatch(inputs), expected)
+
+    def test_native(self):
+        self.check_tape(8)
+        self.check_tape(64)
+
+    def test_wide(self):
+        self.check_tape(128)
+
+    def test_variables(self):
+        x = newSymbolicVariable(32)
+        y = newSymbolicVariable(32)
+        node = bvadd(bvmul(variable(x), bv(3, 32)), variable(y))
+
+        tape = compileAst(node)
+        self.assertEqual(tape.getVariables(), [x.getId(), y.getId()])
+        self.assertEqual(tape.evaluate([1, 2]), 5)
+        self.assertEqual(tape.evaluate({x.getId(): 10, y.getId(): 20}), 50)
+        self.assertRaises(TypeError, tape.evaluate, [1])
+        self.assertEqual(tape.evaluateBatch([[1, 2], [3, 4], {x.getId(): 10, y.getId(): 20}]), [5, 13, 50])
+        self.assertEqual(tape.evaluateBatch([]), [])
+        self.assertRaises(TypeError, tape.evaluateBatch, [[1, 2], [1]])
+
+        # The constant sub-trees are folded
+        tape = compileAst(bvadd(variable(x), bvmul(bv(2, 32), bv(3, 32))))
+        self.assertEqual(tape.getNumberOfInstructions(), 1)
+        self.assertEqual(tape.evaluate([1]), 7)
+
+    def test_references(self):
+        x = newSymbolicVariable(64)
+        expr1 = newSymbolicExpression(bvadd(variable(x), bv(1, 64)))
+        expr2 = newSymbolicExpression(bvmul(reference(expr1.getId()), reference(expr1.getId())))
+
+        tape = compileAst(expr2.getAst())
+        self.assertEqual(tape.getVariables(), [x.getId()])
+        self.assertEqual(tape.evaluate([4]), 25)
+
+    def test_commands(self):
+        x = newSymbolicVariable(8)
+
+        # An assert is the value of its constraint
+        tape = compileAst(assert_(equal(variable(x), bv(5, 8))))
+        self.assertEqual(tape.evaluate([5]), 1)
+        self.assertEqual(tape.evaluate([6]), 0)
+
+        # A name is the value bound by the closest let
+        node = let("a", bvadd(variable(x), bv(1, 8)),
+                   bvmul(string("a"), let("a", bv(2, 8), bvadd(string("a"), string("a")))))
+        tape = compileAst(node)
+        self.assertEqual(tape.evaluate([4]), 20)
+        self.assertRaises(TypeError, compileAst, string("a"))
+
+        self.assertRaises(TypeError, compileAst, compound([variable(x), variable(x)]))
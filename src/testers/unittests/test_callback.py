@@ -4,7 +4,8 @@
 
 import unittest
 
-from triton import *
+from triton     import *
+from triton.ast import *
 
 
 class TestCallback(unittest.TestCase):
@@ -39,8 +40,52 @@ class TestCallback(unittest.TestCase):
         processing(Instruction("\x48\x89\xd8")) # mov rax, rbx
         self.assertFalse(flag)
 
+    def test_symbolic_simplification_kinds(self):
+        global kinds
+        setArchitecture(ARCH.X86_64)
+        a = variable(newSymbolicVariable(8))
+        b = variable(newSymbolicVariable(8))
+
+        # Only the roots of the given kinds call the callback
+        kinds = []
+        addCallback(self.cb_kind, CALLBACK.SYMBOLIC_SIMPLIFICATION, [AST_NODE.BVXOR, AST_NODE.BVAND])
+        simplify(a ^ b)
+        simplify(a + b)
+        simplify(a & b)
+        self.assertEqual(kinds, [AST_NODE.BVXOR, AST_NODE.BVAND])
+        removeCallback(self.cb_kind, CALLBACK.SYMBOLIC_SIMPLIFICATION)
+
+        # Only the roots of the minimum size call the callback
+        kinds = []
+        addCallback(self.cb_kind, CALLBACK.SYMBOLIC_SIMPLIFICATION, [], 32)
+        simplify(a ^ b)
+        simplify(zx(24, a) + zx(24, b))
+        self.assertEqual(kinds, [AST_NODE.BVADD])
+        removeCallback(self.cb_kind, CALLBACK.SYMBOLIC_SIMPLIFICATION)
+
+        # The next callbacks are looked up from the kind of the returned node
+        kinds = []
+        addCallback(self.cb_xor_to_or, CALLBACK.SYMBOLIC_SIMPLIFICATION, [AST_NODE.BVXOR])
+        addCallback(self.cb_kind, CALLBACK.SYMBOLIC_SIMPLIFICATION, [AST_NODE.BVOR])
+        self.assertEqual(simplify(a ^ b).getKind(), AST_NODE.BVOR)
+        self.assertEqual(kinds, [AST_NODE.BVOR])
+        removeAllCallbacks()
+
+        self.assertRaises(TypeError, addCallback, self.cb_flag, CALLBACK.GET_CONCRETE_MEMORY_VALUE, [AST_NODE.BVXOR])
+        self.assertRaises(TypeError, addCallback, self.cb_kind, CALLBACK.SYMBOLIC_SIMPLIFICATION, AST_NODE.BVXOR)
+
     @staticmethod
     def cb_flag(x):
         global flag
         flag = True
 
+    @staticmethod
+    def cb_kind(node):
+        global kinds
+        kinds.append(node.getKind())
+        return node
+
+    @staticmethod
+    def cb_xor_to_or(node):
+        return node.getChilds()[0] | node.getChilds()[1]
+
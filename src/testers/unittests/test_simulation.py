@@ -13,7 +13,9 @@ from triton import (ast, getConcreteMemoryAreaValue, getConcreteRegisterValue,
                     convertMemoryToSymbolicVariable, MemoryAccess, Register,
                     setConcreteRegisterValue, setConcreteMemoryValue, getModel,
                     Elf, concretizeAllMemory, buildSymbolicRegister, MODE,
-                    clearPathConstraints, enableMode, enableSymbolicEngine)
+                    clearPathConstraints, enableMode, enableSymbolicEngine,
+                    getModelsForUntakenBranches, getModelsForAllBranches,
+                    getPathConstraints)
 
 
 class DefCamp2015(object):
@@ -252,8 +254,53 @@ class SeedCoverage(object):
 
         return inputs
 
+    def new_inputs_incremental(self):
+        """Same as new_inputs but via the incremental solver session."""
+        inputs = list()
+
+        for models in getModelsForUntakenBranches():
+            seed = dict()
+            for k, v in models.items():
+                symVar = getSymbolicVariableFromId(k)
+                seed.update({symVar.getKindValue(): v.getValue()})
+            if seed:
+                inputs.append(seed)
+
+        # Clearing path constraints also resets the solver session.
+        clearPathConstraints()
+
+        return inputs
+
+    def new_inputs_parallel(self):
+        """Same as new_inputs but with branches solved on several threads."""
+        inputs = list()
+
+        for models in getModelsForAllBranches(getPathConstraints(), 4):
+            seed = dict()
+            for k, v in models.items():
+                symVar = getSymbolicVariableFromId(k)
+                seed.update({symVar.getKindValue(): v.getValue()})
+            if seed:
+                inputs.append(seed)
+
+        clearPathConstraints()
+
+        return inputs
+
     def test_seed_coverage(self):
         """Found every seed so that every opcode will be use at least once."""
+        self.seed_coverage(self.new_inputs)
+
+    def test_seed_coverage_incremental(self):
+        """Same seed coverage with branches flipped by the solver session."""
+        self.seed_coverage(self.new_inputs_incremental)
+
+    def test_seed_coverage_parallel(self):
+        """Same seed coverage with branches flipped on several threads."""
+        self.seed_coverage(self.new_inputs_parallel)
+
+    def seed_coverage(self, new_inputs):
+        """Run the seed coverage loop with the given inputs generator."""
         # Define entry point
         ENTRY = 0x40056d
 
@@ -277,7 +324,7 @@ class SeedCoverage(object):
             lastInput += [dict(seed)]
             del worklist[0]
 
-            newInputs = self.new_inputs()
+            newInputs = new_inputs()
             for inputs in newInputs:
                 if inputs not in lastInput and inputs not in worklist:
                     worklist += [dict(inputs)]
@@ -382,10 +429,6 @@ class TestSymboliqueEngineAlignedAst(BaseTestSimulation, unittest.TestCase):
         enableMode(MODE.AST_DICTIONARIES, True)
         super(TestSymboliqueEngineAlignedAst, self).setUp()
 
-    @unittest.skip("segfault")
-    def test_defcamp_2015(self):
-        pass
-
 
 class TestSymboliqueEngineAst(BaseTestSimulation, unittest.TestCase):
 
@@ -397,9 +440,16 @@ class TestSymboliqueEngineAst(BaseTestSimulation, unittest.TestCase):
         enableMode(MODE.AST_DICTIONARIES, True)
         super(TestSymboliqueEngineAst, self).setUp()
 
-    @unittest.skip("segfault")
-    def test_defcamp_2015(self):
-        pass
+
+class TestSymboliqueEngineSlicing(BaseTestSimulation, unittest.TestCase):
+
+    """Testing the symbolic engine with PC_SLICING."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.PC_SLICING, True)
+        super(TestSymboliqueEngineSlicing, self).setUp()
 
 
 class TestSymboliqueEngineConcreteAst(BaseTestSimulation, unittest.TestCase):
@@ -419,6 +469,14 @@ class TestSymboliqueEngineConcreteAst(BaseTestSimulation, unittest.TestCase):
     def test_seed_coverage(self):
         pass
 
+    @unittest.skip("No seed coverage with concretization.")
+    def test_seed_coverage_incremental(self):
+        pass
+
+    @unittest.skip("No seed coverage with concretization.")
+    def test_seed_coverage_parallel(self):
+        pass
+
     @unittest.skip("No defcamp with concretization")
     def test_defcamp_2015(self):
         pass
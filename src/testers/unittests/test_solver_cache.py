@@ -0,0 +1,106 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the solver query cache."""
+
+import unittest
+
+from triton     import *
+from triton.ast import *
+
+
+class TestSolverCache(unittest.TestCase):
+
+    """Testing the solver query cache."""
+
+    def setUp(self):
+        """Define the arch."""
+        setArchitecture(ARCH.X86_64)
+        clearSolverCache()
+        self.v0 = newSymbolicVariable(8)
+        self.v1 = newSymbolicVariable(8)
+
+    def test_hit(self):
+        """Same query built twice is solved once."""
+        for _ in range(2):
+            model = getModel(assert_(equal(variable(self.v0), bv(0x41, 8))))
+            self.assertEqual(model[self.v0.getId()].getValue(), 0x41)
+
+        d = getSolverCacheStats()
+        self.assertEqual(d['entries'], 1)
+        self.assertEqual(d['hits'], 1)
+        self.assertEqual(d['misses'], 1)
+
+    def test_key(self):
+        """The key resolves the references and ignores the sharing of sub-trees."""
+        expr = newSymbolicExpression(bvadd(variable(self.v0), bv(1, 8)))
+        shared = bvadd(variable(self.v0), bv(1, 8))
+        getModel(assert_(equal(bvmul(shared, shared), bv(4, 8))))
+        getModel(assert_(equal(bvmul(reference(expr.getId()), bvadd(variable(self.v0), bv(1, 8))), bv(4, 8))))
+        getModel(assert_(equal(bvmul(shared, shared), bv(9, 8))))
+
+        d = getSolverCacheStats()
+        self.assertEqual(d['entries'], 2)
+        self.assertEqual(d['hits'], 1)
+
+    def test_unsat(self):
+        """Unsat verdicts are cached too."""
+        for _ in range(2):
+            self.assertEqual(getModel(assert_(distinct(variable(self.v0), variable(self.v0)))), {})
+
+        d = getSolverCacheStats()
+        self.assertEqual(d['entries'], 1)
+        self.assertEqual(d['hits'], 1)
+
+    def test_status(self):
+        """The status is cached, a sat query may have no variable."""
+        for _ in range(2):
+            self.assertEqual(getModel(assert_(equal(bv(1, 8), bv(1, 8)))), {})
+            self.assertEqual(getSolverQueryStats()['status'], SOLVER.SAT)
+
+        for _ in range(2):
+            self.assertEqual(getModel(assert_(equal(bv(1, 8), bv(2, 8)))), {})
+            self.assertEqual(getSolverQueryStats()['status'], SOLVER.UNSAT)
+
+        self.assertEqual(getSolverCacheStats()['hits'], 2)
+
+    def test_reuse(self):
+        """A previous model is tried before calling the solver."""
+        getModel(assert_(land(equal(variable(self.v0), bv(0x41, 8)), equal(variable(self.v1), bv(0x42, 8)))))
+        model = getModel(assert_(bvugt(variable(self.v1), variable(self.v0))))
+        self.assertEqual(model[self.v0.getId()].getValue(), 0x41)
+        self.assertEqual(model[self.v1.getId()].getValue(), 0x42)
+
+        d = getSolverCacheStats()
+        self.assertEqual(d['misses'], 2)
+        self.assertEqual(d['reused'], 1)
+
+    def test_limit(self):
+        """The least recently used queries are evicted beyond the size limit."""
+        maxBytes = getSolverCacheStats()['max_bytes']
+        self.assertGreater(maxBytes, 0)
+
+        getModel(assert_(equal(variable(self.v0), bv(0x41, 8))))
+        setSolverCacheLimit(getSolverCacheStats()['bytes'] * 2)
+        for i in range(8):
+            getModel(assert_(equal(variable(self.v0), bv(i, 8))))
+
+        d = getSolverCacheStats()
+        self.assertLessEqual(d['bytes'], d['max_bytes'])
+        self.assertGreater(d['evicted'], 0)
+        self.assertLess(d['entries'], 9)
+
+        # The last query is still there, the first one is not
+        getModel(assert_(equal(variable(self.v0), bv(7, 8))))
+        self.assertEqual(getSolverCacheStats()['hits'], 1)
+        getModel(assert_(equal(variable(self.v0), bv(0x41, 8))))
+        self.assertEqual(getSolverCacheStats()['hits'], 1)
+
+        setSolverCacheLimit(maxBytes)
+
+    def test_clear(self):
+        """Clear the cache, its size limit is kept."""
+        getModel(assert_(equal(variable(self.v0), bv(0x41, 8))))
+        clearSolverCache()
+        for k, v in getSolverCacheStats().items():
+            if k != 'max_bytes':
+                self.assertEqual(v, 0)
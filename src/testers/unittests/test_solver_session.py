@@ -0,0 +1,36 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the incremental solver session."""
+
+import unittest
+
+from triton     import *
+from triton.ast import *
+
+
+class TestSolverSession(unittest.TestCase):
+
+    """Testing the incremental solver session."""
+
+    def setUp(self):
+        """Define the arch."""
+        setArchitecture(ARCH.X86_64)
+        self.v0 = newSymbolicVariable(8)
+
+    def test_set_ast(self):
+        """A node whose reference gets another AST is translated again."""
+        expr = newSymbolicExpression(bvadd(variable(self.v0), bv(1, 8)))
+        node = assert_(equal(reference(expr.getId()), bv(5, 8)))
+        self.assertEqual(getModelUnderPathConstraints(node)[self.v0.getId()].getValue(), 4)
+
+        expr.setAst(bvadd(variable(self.v0), bv(2, 8)))
+        self.assertEqual(getModelUnderPathConstraints(node)[self.v0.getId()].getValue(), 3)
+
+    def test_set_child(self):
+        """A node whose child is replaced is translated again."""
+        node = assert_(equal(bvadd(variable(self.v0), bv(1, 8)), bv(5, 8)))
+        newSymbolicExpression(node)
+        self.assertEqual(getModelUnderPathConstraints(node)[self.v0.getId()].getValue(), 4)
+
+        node.getChilds()[0].setChild(1, bv(6, 8))
+        self.assertEqual(getModelUnderPathConstraints(node)[self.v0.getId()].getValue(), 5)
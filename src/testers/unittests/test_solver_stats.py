@@ -0,0 +1,53 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the solver limits and query statistics."""
+
+import unittest
+
+from triton     import *
+from triton.ast import *
+
+
+class TestSolverStats(unittest.TestCase):
+
+    """Testing the solver limits and query statistics."""
+
+    def setUp(self):
+        """Define the arch."""
+        setArchitecture(ARCH.X86_64)
+        self.v0 = newSymbolicVariable(8)
+        self.v1 = newSymbolicVariable(8)
+
+    def test_sat(self):
+        """Stats of a sat query."""
+        getModel(assert_(equal(bvadd(variable(self.v0), variable(self.v1)), bv(0x41, 8))))
+        d = getSolverQueryStats()
+        self.assertEqual(d['status'], SOLVER.SAT)
+        self.assertEqual(d['variables'], 2)
+        self.assertGreater(d['nodes'], 2)
+        self.assertIn('translation_time', d)
+        self.assertIn('solving_time', d)
+
+    def test_unsat(self):
+        """Stats of an unsat query."""
+        self.assertEqual(getModel(assert_(distinct(variable(self.v0), variable(self.v0)))), {})
+        self.assertEqual(getSolverQueryStats()['status'], SOLVER.UNSAT)
+
+    def test_cached(self):
+        """A query answered by the cache is not translated."""
+        getModel(assert_(equal(variable(self.v0), bv(0x41, 8))))
+        getModel(assert_(equal(variable(self.v0), bv(0x41, 8))))
+        d = getSolverQueryStats()
+        self.assertEqual(d['status'], SOLVER.SAT)
+        self.assertEqual(d['nodes'], 0)
+
+    def test_limits(self):
+        """Global and per-call limits."""
+        setSolverTimeout(1000)
+        setSolverMemoryLimit(512)
+        setSolverConflictLimit(100000)
+        model = getModel(assert_(equal(variable(self.v0), bv(0x41, 8))), 500, 256, 1000)
+        self.assertEqual(model[self.v0.getId()].getValue(), 0x41)
+        models = getModels(assert_(bvult(variable(self.v0), bv(4, 8))), 10, 500)
+        self.assertEqual(len(models), 4)
+        self.assertEqual(getSolverQueryStats()['status'], SOLVER.SAT)
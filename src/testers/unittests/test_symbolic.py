@@ -11,7 +11,13 @@ from triton import (setArchitecture, ARCH, processing, REG, Instruction,
                     getSymbolicExpressionFromId, getSymbolicMemoryId,
                     getSymbolicMemoryValue, assignSymbolicExpressionToMemory,
                     assignSymbolicExpressionToRegister, buildSymbolicImmediate,
-                    buildSymbolicRegister, Immediate)
+                    buildSymbolicRegister, Immediate, getFullAst,
+                    getFullAstFromId, sliceExpressions,
+                    getSymbolicExpressions, isSymbolicExpressionIdExists,
+                    getSymbolicMemory, concretizeMemory, concretizeAllMemory,
+                    isMemorySymbolized, convertMemoryToSymbolicVariable,
+                    enableMode, MODE, setConcreteRegisterValue, Register,
+                    getConcreteMemoryValue)
 
 
 class TestSymbolic(unittest.TestCase):
@@ -81,6 +87,46 @@ class TestSymbolic(unittest.TestCase):
 
         self.assertEqual(getSymbolicMemoryValue(mem), 0x11223344)
 
+    def test_bind_expr_across_pages(self):
+        """Check symbolic memory which crosses a page boundary."""
+        expr1 = newSymbolicExpression(ast.bv(0x11223344, 32))
+        mem = MemoryAccess(0x1ffe, CPUSIZE.DWORD)
+        assignSymbolicExpressionToMemory(expr1, mem)
+
+        self.assertEqual(sorted(getSymbolicMemory().keys()), [0x1ffe, 0x1fff, 0x2000, 0x2001])
+        self.assertEqual(getSymbolicMemoryValue(mem), 0x11223344)
+        self.assertEqual(getSymbolicMemoryValue(MemoryAccess(0x2000, CPUSIZE.WORD)), 0x1122)
+        self.assertFalse(isMemorySymbolized(mem))
+
+        concretizeMemory(0x2000)
+        concretizeMemory(0x2001)
+        self.assertEqual(sorted(getSymbolicMemory().keys()), [0x1ffe, 0x1fff])
+        self.assertEqual(getSymbolicMemoryId(0x2000), getSymbolicMemoryId(0x3000))
+
+        convertMemoryToSymbolicVariable(MemoryAccess(0x1fff, CPUSIZE.WORD))
+        self.assertTrue(isMemorySymbolized(MemoryAccess(0x1ff0, CPUSIZE.DQWORD)))
+        self.assertTrue(isMemorySymbolized(MemoryAccess(0x2000, CPUSIZE.BYTE)))
+        self.assertFalse(isMemorySymbolized(MemoryAccess(0x2001, CPUSIZE.DQWORD)))
+
+        concretizeAllMemory()
+        self.assertEqual(getSymbolicMemory(), {})
+        self.assertFalse(isMemorySymbolized(MemoryAccess(0x1ff0, CPUSIZE.DQWORD)))
+
+    def test_remove_memory_expressions(self):
+        """Check the memory of the expressions removed is concrete."""
+        enableMode(MODE.ONLY_ON_SYMBOLIZED, True)
+
+        # mov qword ptr [rax], rbx is not symbolized, its expressions are removed (across a page)
+        setConcreteRegisterValue(Register(REG.RAX, 0x1ffc))
+        setConcreteRegisterValue(Register(REG.RBX, 0x1122334455667788))
+        inst = Instruction()
+        inst.setOpcodes("\x48\x89\x18")
+        processing(inst)
+
+        self.assertEqual(getSymbolicMemory(), {})
+        self.assertEqual(getConcreteMemoryValue(MemoryAccess(0x1ffc, CPUSIZE.QWORD)), 0x1122334455667788)
+        enableMode(MODE.ONLY_ON_SYMBOLIZED, False)
+
     def test_bind_expr_to_register(self):
         """Check symbolic expression binded to register."""
         expr1 = newSymbolicExpression(ast.bv(0x11223344, 64))
@@ -93,6 +139,23 @@ class TestSymbolic(unittest.TestCase):
             # Incorrect size
             assignSymbolicExpressionToRegister(expr1, REG.RAX)
 
+    def test_expressions_by_id(self):
+        """Check the expressions are found by id, over several chunks of ids."""
+        exprs = [newSymbolicExpression(ast.bv(i, 32)) for i in range(3000)]
+        for expr in exprs:
+            self.assertEqual(getSymbolicExpressionFromId(expr.getId()).getAst().evaluate(), expr.getAst().evaluate())
+
+        ids = set(getSymbolicExpressions().keys())
+        for expr in exprs:
+            self.assertTrue(expr.getId() in ids)
+
+        lastId = max(ids)
+        self.assertTrue(isSymbolicExpressionIdExists(lastId))
+        self.assertFalse(isSymbolicExpressionIdExists(lastId + 1))
+        self.assertFalse(isSymbolicExpressionIdExists(lastId + 100000))
+        with self.assertRaises(Exception):
+            getSymbolicExpressionFromId(lastId + 100000)
+
 
 class TestSymbolicBuilding(unittest.TestCase):
 
@@ -132,3 +195,57 @@ class TestSymbolicBuilding(unittest.TestCase):
         node = buildSymbolicRegister(REG.AL)
         self.assertEqual(node.evaluate(), 0x88)
         self.assertEqual(node.getBitvectorSize(), CPUSIZE.BYTE_BIT)
+
+    def test_set_child(self):
+        """Check a new child updates all the ancestors of the node."""
+        c = ast.bvadd(ast.bv(0, CPUSIZE.QWORD_BIT), ast.bv(0, CPUSIZE.QWORD_BIT))
+        d = c
+        for i in range(1000):
+            d = ast.bvadd(d, ast.bv(1, CPUSIZE.QWORD_BIT))
+
+        # A shared ancestor
+        e = ast.bvadd(d, ast.bvmul(c, ast.bv(2, CPUSIZE.QWORD_BIT)))
+
+        c.setChild(1, ast.bv(5, CPUSIZE.QWORD_BIT))
+        self.assertEqual(d.evaluate(), 1005)
+        self.assertEqual(e.evaluate(), 1015)
+        self.assertTrue(e.equalTo(ast.bvadd(d, ast.bvmul(ast.bvadd(ast.bv(0, CPUSIZE.QWORD_BIT), ast.bv(5, CPUSIZE.QWORD_BIT)), ast.bv(2, CPUSIZE.QWORD_BIT)))))
+
+    def test_full_ast(self):
+        """Check the full AST is built without modifying the partial one."""
+        expr1 = newSymbolicExpression(ast.bv(1, CPUSIZE.QWORD_BIT))
+        expr2 = newSymbolicExpression(ast.bvadd(ast.reference(expr1.getId()), ast.bv(2, CPUSIZE.QWORD_BIT)))
+        expr3 = newSymbolicExpression(ast.bvmul(ast.reference(expr2.getId()), ast.reference(expr2.getId())))
+
+        partial = str(expr3.getAst())
+        full = getFullAst(expr3.getAst())
+        self.assertEqual(str(expr3.getAst()), partial)
+        self.assertEqual(str(full), "(bvmul (bvadd (_ bv1 64) (_ bv2 64)) (bvadd (_ bv1 64) (_ bv2 64)))")
+        self.assertEqual(full.evaluate(), 9)
+
+        # The full ASTs are kept between two calls
+        self.assertTrue(getFullAstFromId(expr3.getId()).equalTo(full))
+
+        # and follow the expressions
+        expr1.setAst(ast.bv(3, CPUSIZE.QWORD_BIT))
+        self.assertEqual(getFullAst(expr3.getAst()).evaluate(), 25)
+        expr2.getAst().setChild(1, ast.bv(4, CPUSIZE.QWORD_BIT))
+        self.assertEqual(getFullAst(expr3.getAst()).evaluate(), 49)
+
+    def test_deep_ast(self):
+        """Check the passes over the ASTs do not recurse on deep trees."""
+        depth = 100000
+
+        a = ast.bv(0, CPUSIZE.QWORD_BIT)
+        b = ast.bv(0, CPUSIZE.QWORD_BIT)
+        for i in range(depth):
+            a = ast.bvadd(a, ast.bv(1, CPUSIZE.QWORD_BIT))
+            b = ast.bvadd(ast.bv(1, CPUSIZE.QWORD_BIT), b)
+        self.assertEqual(a.evaluate(), depth)
+        self.assertTrue(a.equalTo(b))
+
+        expr = newSymbolicExpression(ast.bv(0, CPUSIZE.QWORD_BIT))
+        for i in range(depth):
+            expr = newSymbolicExpression(ast.bvadd(ast.reference(expr.getId()), ast.bv(1, CPUSIZE.QWORD_BIT)))
+        self.assertEqual(getFullAst(expr.getAst()).evaluate(), depth)
+        self.assertEqual(len(sliceExpressions(expr)), depth + 1)
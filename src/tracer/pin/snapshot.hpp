@@ -10,6 +10,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include <pin.H>
 
@@ -52,7 +53,7 @@ namespace tracer {
         bool mustBeRestore;
 
         //! AST node state.
-        std::set<triton::ast::AbstractNode*> nodesList;
+        std::vector<triton::ast::AbstractNode*> nodesList;
 
         //! Variables node state.
         std::map<std::string, triton::ast::AbstractNode*> variablesMap;